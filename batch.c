@@ -0,0 +1,302 @@
+/**
+ * Implémentation de la résolution en lot du TSP
+ */
+#include "batch.h"
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+// ══════════════════════════════════════════════════════════════════
+// ESPACE DE TRAVAIL (UN PAR THREAD)
+// ══════════════════════════════════════════════════════════════════
+typedef struct {
+    int tour[MAX_CITIES];           // Tour en cours de construction
+    int bestTour[MAX_CITIES];       // Meilleur tour trouvé
+    Weight bestDistance;            // Distance du meilleur tour
+    Weight* dp;                     // Held-Karp : coûts [sous-ensemble][ville]
+    unsigned char* parent;          // Held-Karp : prédécesseurs
+} TSPWorkspace;
+
+/**
+ * Prépare l'espace de travail pour des instances d'au plus maxCities
+ * villes : 2^(maxCities-1) sous-ensembles × (maxCities-1) villes
+ */
+static int initWorkspace(TSPWorkspace* ws, int maxCities) {
+    ws->dp = NULL;
+    ws->parent = NULL;
+    if (maxCities <= BATCH_BRUTE_FORCE_MAX) {
+        return 1;   // Brute Force uniquement : pas de table
+    }
+    size_t cells = ((size_t)1 << (maxCities - 1)) * (maxCities - 1);
+    ws->dp = (Weight*)malloc(sizeof(Weight) * cells);
+    ws->parent = (unsigned char*)malloc(cells);
+    if (ws->dp == NULL || ws->parent == NULL) {
+        free(ws->dp);
+        free(ws->parent);
+        return 0;
+    }
+    return 1;
+}
+
+static void releaseWorkspace(TSPWorkspace* ws) {
+    free(ws->dp);
+    free(ws->parent);
+}
+// ══════════════════════════════════════════════════════════════════
+// ALGORITHMES EXACTS SUR MATRICE COMPACTÉE (d[i * n + j])
+// ══════════════════════════════════════════════════════════════════
+/**
+ * Brute Force avec élagage : abandonne une branche dès que la distance
+ * partielle atteint la meilleure distance connue
+ */
+static void searchTour(const Weight* d, int n, int depth, Weight length,
+                       unsigned int usedMask, TSPWorkspace* ws) {
+    int last = ws->tour[depth - 1];
+    if (depth == n) {
+        Weight total = addWeights(length, d[last * n]);
+        if (total < ws->bestDistance) {
+            ws->bestDistance = total;
+            memcpy(ws->bestTour, ws->tour, sizeof(int) * n);
+        }
+        return;
+    }
+    for (int city = 1; city < n; city++) {
+        if (usedMask & (1u << city)) continue;
+        // Une arête INF sature la somme : branche élaguée d'office
+        Weight next = addWeights(length, d[last * n + city]);
+        if (next >= ws->bestDistance) continue;
+        ws->tour[depth] = city;
+        searchTour(d, n, depth + 1, next, usedMask | (1u << city), ws);
+    }
+}
+
+static Weight solveBruteForce(const Weight* d, int n, TSPWorkspace* ws) {
+    ws->bestDistance = INF;
+    ws->tour[0] = 0;
+    searchTour(d, n, 1, 0, 1u, ws);
+    return ws->bestDistance;
+}
+
+/**
+ * Held-Karp : programmation dynamique sur les sous-ensembles
+ * dp[S][j] = plus court chemin partant de 0, visitant S, finissant en j
+ * Les villes 1..n-1 correspondent aux bits 0..n-2.
+ * Complexité : O(n² · 2ⁿ)
+ */
+static Weight solveHeldKarp(const Weight* d, int n, TSPWorkspace* ws) {
+    int m = n - 1;
+    int full = (1 << m) - 1;
+    Weight* dp = ws->dp;
+    unsigned char* parent = ws->parent;
+
+    for (int mask = 1; mask <= full; mask++) {
+        for (int j = 0; j < m; j++) {
+            Weight* cell = &dp[mask * m + j];
+            *cell = INF;
+            if (!(mask & (1 << j))) continue;
+            int prevMask = mask ^ (1 << j);
+            if (prevMask == 0) {
+                *cell = d[j + 1];
+                parent[mask * m + j] = 0;
+                continue;
+            }
+            for (int k = 0; k < m; k++) {
+                if (!(prevMask & (1 << k))) continue;
+                Weight candidate = addWeights(dp[prevMask * m + k],
+                                              d[(k + 1) * n + (j + 1)]);
+                if (candidate >= *cell) continue;
+                *cell = candidate;
+                parent[mask * m + j] = (unsigned char)(k + 1);
+            }
+        }
+    }
+
+    // Fermer le cycle vers la ville 0
+    Weight best = INF;
+    int last = -1;
+    for (int j = 0; j < m; j++) {
+        Weight candidate = addWeights(dp[full * m + j], d[(j + 1) * n]);
+        if (candidate >= best) continue;
+        best = candidate;
+        last = j + 1;
+    }
+    ws->bestDistance = best;
+    if (best == INF) return INF;
+
+    // Reconstruction du tour à rebours
+    int mask = full;
+    for (int pos = n - 1; pos >= 1; pos--) {
+        ws->bestTour[pos] = last;
+        int prevCity = parent[mask * m + (last - 1)];
+        mask ^= 1 << (last - 1);
+        last = prevCity;
+    }
+    ws->bestTour[0] = 0;
+    return best;
+}
+
+static void solveInstance(const Weight* d, int n, TSPWorkspace* ws, TSPResult* result) {
+    if (n == 1) {
+        result->tour[0] = 0;
+        result->tour[1] = 0;
+        result->tourLength = 2;
+        result->totalDistance = 0;
+        return;
+    }
+    Weight distance = (n <= BATCH_BRUTE_FORCE_MAX) ? solveBruteForce(d, n, ws)
+                                                : solveHeldKarp(d, n, ws);
+    result->totalDistance = distance;
+    if (distance == INF) {
+        result->tourLength = 0;
+        return;
+    }
+    memcpy(result->tour, ws->bestTour, sizeof(int) * n);
+    result->tour[n] = 0;
+    result->tourLength = n + 1;
+}
+// ══════════════════════════════════════════════════════════════════
+// RÉSOLUTION D'UNE SEULE INSTANCE
+// ══════════════════════════════════════════════════════════════════
+// Table de Held-Karp pour MAX_CITIES villes, allouée une fois pour toutes
+static Weight exactDp[((size_t)1 << (MAX_CITIES - 1)) * (MAX_CITIES - 1)];
+static unsigned char exactParent[((size_t)1 << (MAX_CITIES - 1)) * (MAX_CITIES - 1)];
+
+TSPResult solveTSPExact(Weight distMatrix[MAX_CITIES][MAX_CITIES],
+                        int numCities,
+                        int startCity) {
+    TSPResult result;
+    if (numCities <= 0 || numCities > MAX_CITIES ||
+        startCity < 0 || startCity >= numCities) {
+        result.totalDistance = INF;
+        result.tourLength = 0;
+        return result;
+    }
+    Weight d[MAX_CITIES * MAX_CITIES];
+    for (int i = 0; i < numCities; i++) {
+        memcpy(d + i * numCities, distMatrix[i], sizeof(Weight) * numCities);
+    }
+    TSPWorkspace ws;
+    ws.dp = exactDp;
+    ws.parent = exactParent;
+    TSPResult fromZero;
+    solveInstance(d, numCities, &ws, &fromZero);
+    if (fromZero.tourLength == 0) return fromZero;
+
+    // Le tour part de la ville 0 : le faire partir de startCity
+    int offset = 0;
+    while (fromZero.tour[offset] != startCity) offset++;
+    for (int i = 0; i < numCities; i++) {
+        result.tour[i] = fromZero.tour[(offset + i) % numCities];
+    }
+    result.tour[numCities] = startCity;
+    result.tourLength = numCities + 1;
+    result.totalDistance = fromZero.totalDistance;
+    return result;
+}
+// ══════════════════════════════════════════════════════════════════
+// GESTION DU LOT
+// ══════════════════════════════════════════════════════════════════
+TSPBatch* createTSPBatch(int capacity, int totalCells) {
+    if (capacity <= 0 || totalCells <= 0) {
+        printf("Erreur: taille de lot invalide\n");
+        return NULL;
+    }
+    TSPBatch* batch = (TSPBatch*)malloc(sizeof(TSPBatch));
+    if (batch == NULL) {
+        printf("Erreur: allocation memoire echouee\n");
+        return NULL;
+    }
+    batch->numCities = (int*)malloc(sizeof(int) * capacity);
+    batch->offsets = (int*)malloc(sizeof(int) * capacity);
+    batch->cells = (Weight*)malloc(sizeof(Weight) * totalCells);
+    if (batch->numCities == NULL || batch->offsets == NULL || batch->cells == NULL) {
+        printf("Erreur: allocation memoire echouee\n");
+        freeTSPBatch(batch);
+        return NULL;
+    }
+    batch->numInstances = 0;
+    batch->capacity = capacity;
+    batch->cellsUsed = 0;
+    batch->cellsCapacity = totalCells;
+    batch->maxCities = 0;
+    return batch;
+}
+
+int addTSPBatchInstance(TSPBatch* batch,
+                        Weight distMatrix[MAX_CITIES][MAX_CITIES],
+                        int numCities) {
+    if (batch == NULL || numCities <= 0 || numCities > MAX_CITIES) {
+        return -1;
+    }
+    int size = numCities * numCities;
+    if (batch->numInstances >= batch->capacity ||
+        batch->cellsUsed + size > batch->cellsCapacity) {
+        return -1;
+    }
+    int index = batch->numInstances++;
+    Weight* cells = batch->cells + batch->cellsUsed;
+    batch->numCities[index] = numCities;
+    batch->offsets[index] = batch->cellsUsed;
+    if (numCities > batch->maxCities) {
+        batch->maxCities = numCities;
+    }
+    for (int i = 0; i < numCities; i++) {
+        memcpy(cells + i * numCities, distMatrix[i], sizeof(Weight) * numCities);
+    }
+    batch->cellsUsed += size;
+    return index;
+}
+
+void solveTSPBatch(TSPBatch* batch, TSPResult* results, int numThreads) {
+    if (batch == NULL || results == NULL) return;
+    int count = batch->numInstances;
+#ifdef _OPENMP
+    if (numThreads <= 0) numThreads = omp_get_max_threads();
+#else
+    numThreads = 1;
+#endif
+    // Espaces de travail alloués une fois pour toutes, avant la boucle
+    TSPWorkspace* workspaces = (TSPWorkspace*)malloc(sizeof(TSPWorkspace) * numThreads);
+    int ready = 0;
+    if (workspaces != NULL) {
+        while (ready < numThreads && initWorkspace(&workspaces[ready], batch->maxCities)) {
+            ready++;
+        }
+    }
+    if (ready < numThreads) {
+        printf("Erreur: allocation memoire echouee\n");
+        for (int t = 0; t < ready; t++) releaseWorkspace(&workspaces[t]);
+        free(workspaces);
+        for (int k = 0; k < count; k++) {
+            results[k].totalDistance = INF;
+            results[k].tourLength = 0;
+        }
+        return;
+    }
+
+    // Blocs d'instances consécutives par thread : accès mémoire contigus
+#ifdef _OPENMP
+    #pragma omp parallel for num_threads(numThreads) schedule(dynamic, 16)
+#endif
+    for (int k = 0; k < count; k++) {
+#ifdef _OPENMP
+        TSPWorkspace* ws = &workspaces[omp_get_thread_num()];
+#else
+        TSPWorkspace* ws = &workspaces[0];
+#endif
+        solveInstance(batch->cells + batch->offsets[k],
+                      batch->numCities[k], ws, &results[k]);
+    }
+
+    for (int t = 0; t < numThreads; t++) releaseWorkspace(&workspaces[t]);
+    free(workspaces);
+}
+
+void freeTSPBatch(TSPBatch* batch) {
+    if (batch != NULL) {
+        free(batch->numCities);
+        free(batch->offsets);
+        free(batch->cells);
+        free(batch);
+    }
+}
@@ -0,0 +1,84 @@
+/**
+ *      Résolution en lot de nombreuses petites instances du TSP
+ */
+#ifndef BATCH_H
+#define BATCH_H
+#include "tsp.h"
+// ══════════════════════════════════════════════════════════════════
+// CONSTANTES
+// ══════════════════════════════════════════════════════════════════
+#define BATCH_BRUTE_FORCE_MAX 8     // Au-delà : programmation dynamique
+// ══════════════════════════════════════════════════════════════════
+// STRUCTURES DE DONNÉES
+// ══════════════════════════════════════════════════════════════════
+/**
+ * Lot d'instances indépendantes du TSP
+ * Les matrices n×n sont rangées les unes à la suite des autres dans
+ * un seul tableau (cells) pour garder les données contiguës en mémoire.
+ * numCities[k] : nombre de villes de l'instance k
+ * offsets[k]   : position de la matrice de l'instance k dans cells
+ */
+typedef struct {
+    int numInstances;       // Nombre d'instances ajoutées
+    int capacity;           // Nombre maximum d'instances
+    int* numCities;         // Taille de chaque instance
+    int* offsets;           // Début de chaque matrice dans cells
+    Weight* cells;          // Matrices des distances, compactées
+    int cellsUsed;          // Nombre de cases occupées dans cells
+    int cellsCapacity;      // Nombre total de cases de cells
+    int maxCities;          // Taille de la plus grande instance
+} TSPBatch;
+
+// ══════════════════════════════════════════════════════════════════
+// PROTOTYPES DES FONCTIONS
+// ══════════════════════════════════════════════════════════════════
+
+/**
+ * Crée un lot vide
+ * @param capacity : nombre maximum d'instances
+ * @param totalCells : somme des n² de toutes les instances prévues
+ * @return : pointeur vers le lot créé (NULL en cas d'erreur)
+ */
+TSPBatch* createTSPBatch(int capacity, int totalCells);
+/**
+ * Ajoute une instance au lot (la matrice est recopiée)
+ * @param batch : le lot
+ * @param distMatrix : matrice des distances de l'instance
+ * @param numCities : nombre de villes de l'instance
+ * @return : index de l'instance dans le lot, -1 si le lot est plein
+ */
+int addTSPBatchInstance(TSPBatch* batch,
+                        Weight distMatrix[MAX_CITIES][MAX_CITIES],
+                        int numCities);
+/**
+ * Résout toutes les instances du lot (tour partant de la ville 0)
+ * Choisit l'algorithme exact selon la taille : Brute Force avec
+ * élagage jusqu'à BATCH_BRUTE_FORCE_MAX villes, Held-Karp au-delà.
+ * Chaque thread réutilise son propre espace de travail, alloué une
+ * seule fois : aucune allocation par instance, aucun affichage.
+ * La table de Held-Karp est dimensionnée sur la plus grande instance
+ * du lot, et n'est pas allouée si aucune n'en a besoin.
+ * @param batch : le lot
+ * @param results : tableau d'au moins batch->numInstances résultats
+ * @param numThreads : nombre de threads (<= 0 : valeur par défaut)
+ */
+void solveTSPBatch(TSPBatch* batch, TSPResult* results, int numThreads);
+/**
+ * Résout une seule instance de façon exacte, sans créer de lot
+ * Même choix d'algorithme que solveTSPBatch ; la table de Held-Karp
+ * est statique : fonction non réentrante (un appel à la fois).
+ * @param distMatrix : matrice des distances
+ * @param numCities : nombre de villes (au plus MAX_CITIES)
+ * @param startCity : ville de départ du tour
+ * @return : tour optimal partant de startCity (totalDistance = INF
+ *           si aucun tour n'existe ou si les paramètres sont invalides)
+ */
+TSPResult solveTSPExact(Weight distMatrix[MAX_CITIES][MAX_CITIES],
+                        int numCities,
+                        int startCity);
+/**
+ * Libère la mémoire du lot
+ * @param batch : le lot à libérer
+ */
+void freeTSPBatch(TSPBatch* batch);
+#endif // BATCH_H
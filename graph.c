@@ -56,7 +56,7 @@ Graph* createGraph(int numCities) {
 /**
  * Ajoute une arête (route) bidirectionnelle entre deux villes
  */
-void addEdge(Graph* graph, int src, int dest, int weight) {
+void addEdge(Graph* graph, int src, int dest, Weight weight) {
     // Vérifications de sécurité
     if (graph == NULL) {
         printf("Erreur: graphe NULL\n");
@@ -66,10 +66,12 @@ void addEdge(Graph* graph, int src, int dest, int weight) {
         printf("Erreur: index de ville invalide (src=%d, dest=%d)\n", src, dest);
         return;
     }
+#if !defined(WEIGHT_UINT16)
     if (weight < 0) {
         printf("Erreur: poids negatif non supporte par Dijkstra\n");
         return;
     }
+#endif
 
     // Ajout de l'arête dans les deux sens (graphe non orienté)
     graph->adjMatrix[src][dest] = weight;
@@ -120,7 +122,7 @@ void displayGraph(Graph* graph) {
             if (graph->adjMatrix[i][j] == INF) {
                 printf("%8s", "INF");
             } else {
-                printf("%8d", graph->adjMatrix[i][j]);
+                printf("%8" WEIGHT_FMT, WEIGHT_PRINT(graph->adjMatrix[i][j]));
             }
         }
         printf("\n");
@@ -144,8 +146,8 @@ void freeGraph(Graph* graph) {
 /**
  * Fonction auxiliaire : trouve le sommet non visité avec la distance minimale
  */
-static int findMinDistance(int* dist, int* visited, int numCities) {
-    int min = INF;
+static int findMinDistance(Weight* dist, int* visited, int numCities) {
+    Weight min = INF;
     int minIndex = -1;
 
     for (int v = 0; v < numCities; v++) {
@@ -166,12 +168,13 @@ static int findMinDistance(int* dist, int* visited, int numCities) {
  * 2. Répéter :
  *    a) Choisir le sommet non visité avec la plus petite distance
  *    b) Marquer comme visité
- *    c) Mettre à jour les distances des voisins
+ *    c) Arrêter si c'est la destination (sa distance est définitive)
+ *    d) Mettre à jour les distances des voisins
  * 3. Reconstruire le chemin
  *
  * Complexité : O(V²)
  */
-int dijkstra(Graph* graph, int src, int dest, int* path, int* pathLength) {
+Weight dijkstra(Graph* graph, int src, int dest, int* path, int* pathLength) {
     // Vérifications
     if (graph == NULL || src < 0 || src >= graph->numCities ||
         dest < 0 || dest >= graph->numCities) {
@@ -179,7 +182,7 @@ int dijkstra(Graph* graph, int src, int dest, int* path, int* pathLength) {
     }
 
     int numCities = graph->numCities;
-    int dist[MAX_CITIES];      // Distance minimale depuis la source
+    Weight dist[MAX_CITIES];   // Distance minimale depuis la source
     int visited[MAX_CITIES];   // Sommets déjà traités
     int parent[MAX_CITIES];    // Prédécesseur dans le chemin
 
@@ -199,17 +202,15 @@ int dijkstra(Graph* graph, int src, int dest, int* path, int* pathLength) {
         if (u == -1) break;
 
         visited[u] = 1;
+        if (u == dest) break;   // Arrêt anticipé
 
         // Mettre à jour les distances des voisins
+        // (addWeights sature à INF : ni test d'INF ni saut dans la boucle)
         for (int v = 0; v < numCities; v++) {
-            if (!visited[v] &&
-                graph->adjMatrix[u][v] != INF &&
-                dist[u] != INF &&
-                dist[u] + graph->adjMatrix[u][v] < dist[v]) {
-
-                dist[v] = dist[u] + graph->adjMatrix[u][v];
-                parent[v] = u;
-            }
+            Weight candidate = addWeights(dist[u], graph->adjMatrix[u][v]);
+            int better = !visited[v] & (candidate < dist[v]);
+            dist[v] = better ? candidate : dist[v];
+            parent[v] = better ? u : parent[v];
         }
     }
 
@@ -235,20 +236,84 @@ int dijkstra(Graph* graph, int src, int dest, int* path, int* pathLength) {
     return dist[dest];
 }
 
+/**
+ * Dijkstra complet vers une destination, sur le graphe inversé
+ * Le prédécesseur de v dans cet arbre est la ville qui suit v
+ * sur le plus court chemin de v vers dest.
+ * incoming[u][v] est le poids de l'arête v -> u (matrice transposée) :
+ * la relaxation parcourt une ligne contiguë et se vectorise.
+ */
+static void shortestPathsTo(Weight incoming[MAX_CITIES][MAX_CITIES], int numCities,
+                            int dest, Weight* restrict dist, int* restrict next) {
+    int visited[MAX_CITIES];
+
+    for (int i = 0; i < numCities; i++) {
+        dist[i] = INF;
+        visited[i] = 0;
+        next[i] = -1;
+    }
+    dist[dest] = 0;
+
+    for (int count = 0; count < numCities; count++) {
+        int u = findMinDistance(dist, visited, numCities);
+
+        if (u == -1) break;
+
+        visited[u] = 1;
+
+        // Arêtes entrantes v -> u
+        for (int v = 0; v < numCities; v++) {
+            Weight candidate = addWeights(dist[u], incoming[u][v]);
+            int better = !visited[v] & (candidate < dist[v]);
+            dist[v] = better ? candidate : dist[v];
+            next[v] = better ? u : next[v];
+        }
+    }
+}
+
 /**
  * Calcule les distances minimales entre toutes les paires de villes
  */
-void computeAllPairsShortestPaths(Graph* graph, int distMatrix[MAX_CITIES][MAX_CITIES]) {
+void computeAllPairsShortestPaths(Graph* graph, Weight distMatrix[MAX_CITIES][MAX_CITIES]) {
+    computeAllPairsShortestPathsWithHops(graph, distMatrix, NULL);
+}
+
+/**
+ * Calcule les distances minimales et les prochains sauts
+ *
+ * Un seul Dijkstra (inversé) par ville d'arrivée j donne à la fois
+ * la colonne j de distMatrix et la colonne j de nextHop.
+ *
+ * Complexité : O(V³)
+ */
+void computeAllPairsShortestPathsWithHops(Graph* graph,
+                                          Weight distMatrix[MAX_CITIES][MAX_CITIES],
+                                          HopIndex nextHop[MAX_CITIES][MAX_CITIES]) {
     if (graph == NULL) return;
 
     printf("Calcul des plus courts chemins entre toutes les paires...\n");
 
-    for (int i = 0; i < graph->numCities; i++) {
-        for (int j = 0; j < graph->numCities; j++) {
-            if (i == j) {
-                distMatrix[i][j] = 0;
-            } else {
-                distMatrix[i][j] = dijkstra(graph, i, j, NULL, NULL);
+    // Transposée calculée une fois : arêtes entrantes rangées par ligne
+    int numCities = graph->numCities;
+    Weight incoming[MAX_CITIES][MAX_CITIES];
+    for (int u = 0; u < numCities; u++) {
+        for (int v = 0; v < numCities; v++) {
+            incoming[u][v] = graph->adjMatrix[v][u];
+        }
+    }
+
+    Weight dist[MAX_CITIES];
+    int next[MAX_CITIES];
+    for (int j = 0; j < numCities; j++) {
+        shortestPathsTo(incoming, numCities, j, dist, next);
+        for (int i = 0; i < numCities; i++) {
+            distMatrix[i][j] = dist[i];
+            if (nextHop != NULL) {
+                if (i == j) {
+                    nextHop[i][j] = (HopIndex)j;
+                } else {
+                    nextHop[i][j] = (next[i] == -1) ? NO_HOP : (HopIndex)next[i];
+                }
             }
         }
     }
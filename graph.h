@@ -6,18 +6,30 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <limits.h>
+#include "weight.h"
 // ══════════════════════════════════════════════════════════════════
 // CONSTANTES
 // ══════════════════════════════════════════════════════════════════
-#define MAX_CITIES 10       // Nombre maximum de villes
-#define INF INT_MAX         // Valeur "infini" (pas de connexion)
+#define MAX_CITIES 16       // Nombre maximum de villes
+// Type Weight et valeur INF (pas de connexion) : voir weight.h
+// Type le plus étroit capable de stocker un index de ville (tables de saut)
+#if MAX_CITIES < UCHAR_MAX
+typedef unsigned char HopIndex;
+#define NO_HOP UCHAR_MAX    // Pas de saut (villes non reliées)
+#elif MAX_CITIES < USHRT_MAX
+typedef unsigned short HopIndex;
+#define NO_HOP USHRT_MAX
+#else
+typedef int HopIndex;
+#define NO_HOP -1
+#endif
 // ══════════════════════════════════════════════════════════════════
 // STRUCTURES DE DONNÉES
 // ══════════════════════════════════════════════════════════════════
 typedef struct {
-    int numCities;                          // Nombre de villes
-    int adjMatrix[MAX_CITIES][MAX_CITIES];  // Matrice d'adjacence
-    char cityNames[MAX_CITIES][50];         // Noms des villes
+    int numCities;                             // Nombre de villes
+    Weight adjMatrix[MAX_CITIES][MAX_CITIES];  // Matrice d'adjacence
+    char cityNames[MAX_CITIES][50];            // Noms des villes
 } Graph;
 // ══════════════════════════════════════════════════════════════════
 // PROTOTYPES DES FONCTIONS
@@ -35,7 +47,7 @@ Graph* createGraph(int numCities);
  * @param dest : ville destination (index)
  * @param weight : distance/poids de la route
  */
-void addEdge(Graph* graph, int src, int dest, int weight);
+void addEdge(Graph* graph, int src, int dest, Weight weight);
 /**
  * Définit le nom d'une ville
  * @param graph : le graphe
@@ -55,6 +67,7 @@ void displayGraph(Graph* graph);
 void freeGraph(Graph* graph);
 /**
  * Algorithme de Dijkstra - trouve le plus court chemin
+ * S'arrête dès que dest est fixée (voir search.h pour A* et ALT)
  * @param graph : le graphe
  * @param src : ville de départ
  * @param dest : ville d'arrivée
@@ -62,11 +75,22 @@ void freeGraph(Graph* graph);
  * @param pathLength : longueur du chemin trouvé
  * @return : distance minimale entre src et dest
  */
-int dijkstra(Graph* graph, int src, int dest, int* path, int* pathLength);
+Weight dijkstra(Graph* graph, int src, int dest, int* path, int* pathLength);
 /**
  * Calcule toutes les distances minimales entre toutes les paires de villes
  * @param graph : le graphe original
  * @param distMatrix : matrice pour stocker les distances minimales
  */
-void computeAllPairsShortestPaths(Graph* graph, int distMatrix[MAX_CITIES][MAX_CITIES]);
+void computeAllPairsShortestPaths(Graph* graph, Weight distMatrix[MAX_CITIES][MAX_CITIES]);
+/**
+ * Calcule toutes les distances minimales et la table des prochains sauts
+ * nextHop[i][j] : ville suivant i sur le plus court chemin de i vers j
+ * (NO_HOP si j est inatteignable depuis i, j si i == j)
+ * @param graph : le graphe original
+ * @param distMatrix : matrice pour stocker les distances minimales
+ * @param nextHop : table des prochains sauts (peut être NULL)
+ */
+void computeAllPairsShortestPathsWithHops(Graph* graph,
+                                          Weight distMatrix[MAX_CITIES][MAX_CITIES],
+                                          HopIndex nextHop[MAX_CITIES][MAX_CITIES]);
 #endif // GRAPH_H
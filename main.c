@@ -6,6 +6,10 @@
 #include <string.h>
 #include "graph.h"
 #include "tsp.h"
+#include "batch.h"
+#include "search.h"
+#include "reopt.h"
+#include "twolevel.h"
 // ══════════════════════════════════════════════════════════════════
 // CRÉATION DU GRAPHE DE TEST
 // ══════════════════════════════════════════════════════════════════
@@ -29,25 +33,25 @@ Graph* createTestGraph() {
     setCityName(graph, 9, "El Jadida");
     // Ajouter les routes (distances en km)
     // Routes depuis Casablanca (0)
-    addEdge(graph, 0, 1, 87);    // Casablanca - Rabat
-    addEdge(graph, 0, 2, 243);   // Casablanca - Marrakech
-    addEdge(graph, 0, 9, 96);    // Casablanca - El Jadida
-    addEdge(graph, 0, 3, 295);   // Casablanca - Fes
+    addEdge(graph, 0, 1, WEIGHT_FROM_INT(87));    // Casablanca - Rabat
+    addEdge(graph, 0, 2, WEIGHT_FROM_INT(243));   // Casablanca - Marrakech
+    addEdge(graph, 0, 9, WEIGHT_FROM_INT(96));    // Casablanca - El Jadida
+    addEdge(graph, 0, 3, WEIGHT_FROM_INT(295));   // Casablanca - Fes
     // Routes depuis Rabat (1)
-    addEdge(graph, 1, 4, 250);   // Rabat - Tanger
-    addEdge(graph, 1, 3, 207);   // Rabat - Fes
-    addEdge(graph, 1, 6, 138);   // Rabat - Meknes
+    addEdge(graph, 1, 4, WEIGHT_FROM_INT(250));   // Rabat - Tanger
+    addEdge(graph, 1, 3, WEIGHT_FROM_INT(207));   // Rabat - Fes
+    addEdge(graph, 1, 6, WEIGHT_FROM_INT(138));   // Rabat - Meknes
     // Routes depuis Marrakech (2)
-    addEdge(graph, 2, 5, 258);   // Marrakech - Agadir
-    addEdge(graph, 2, 9, 200);   // Marrakech - El Jadida
+    addEdge(graph, 2, 5, WEIGHT_FROM_INT(258));   // Marrakech - Agadir
+    addEdge(graph, 2, 9, WEIGHT_FROM_INT(200));   // Marrakech - El Jadida
     // Routes depuis Fes (3)
-    addEdge(graph, 3, 6, 60);    // Fes - Meknes
-    addEdge(graph, 3, 7, 332);   // Fes - Oujda
-    addEdge(graph, 3, 4, 303);   // Fes - Tanger
+    addEdge(graph, 3, 6, WEIGHT_FROM_INT(60));    // Fes - Meknes
+    addEdge(graph, 3, 7, WEIGHT_FROM_INT(332));   // Fes - Oujda
+    addEdge(graph, 3, 4, WEIGHT_FROM_INT(303));   // Fes - Tanger
     // Routes depuis Tanger (4)
-    addEdge(graph, 4, 8, 60);    // Tanger - Tetouan
+    addEdge(graph, 4, 8, WEIGHT_FROM_INT(60));    // Tanger - Tetouan
     // Routes depuis Agadir (5)
-    addEdge(graph, 5, 9, 296);   // Agadir - El Jadida
+    addEdge(graph, 5, 9, WEIGHT_FROM_INT(296));   // Agadir - El Jadida
     return graph;
 }
 // ══════════════════════════════════════════════════════════════════
@@ -66,11 +70,11 @@ void testDijkstra(Graph* graph) {
     // Test 1 : Casablanca vers Oujda
     printf("Test 1 : Casablanca -> Oujda\n");
     printf("----------------------------\n");
-    int dist = dijkstra(graph, 0, 7, path, &pathLength);
+    Weight dist = dijkstra(graph, 0, 7, path, &pathLength);
     if (dist == INF) {
         printf("Pas de chemin trouve!\n");
     } else {
-        printf("Distance minimale : %d km\n", dist);
+        printf("Distance minimale : %" WEIGHT_FMT " km\n", WEIGHT_PRINT(dist));
         printf("Chemin : ");
         for (int i = 0; i < pathLength; i++) {
             printf("%s", graph->cityNames[path[i]]);
@@ -85,7 +89,7 @@ void testDijkstra(Graph* graph) {
     if (dist == INF) {
         printf("Pas de chemin trouve!\n");
     } else {
-        printf("Distance minimale : %d km\n", dist);
+        printf("Distance minimale : %" WEIGHT_FMT " km\n", WEIGHT_PRINT(dist));
         printf("Chemin : ");
         for (int i = 0; i < pathLength; i++) {
             printf("%s", graph->cityNames[path[i]]);
@@ -95,6 +99,47 @@ void testDijkstra(Graph* graph) {
     }
     printf("\n");
 }
+/**
+ * Test des recherches orientées vers la cible
+ * Compare le nombre de villes fixées par chaque méthode
+ */
+void testGoalDirected(Graph* graph) {
+    printf("\n");
+    printf("+========================================+\n");
+    printf("|     TEST A* / ALT / BIDIRECTIONNEL     |\n");
+    printf("+========================================+\n\n");
+    // Coordonnées approximatives en km (longitude x 92.6, latitude x 111)
+    // scale = 0.8 : la distance à vol d'oiseau reste sous la distance routière
+    CityCoordinates coords = {
+        { -702.8, -633.4, -741.7, -463.0, -539.9, -889.0, -513.9, -176.9, -497.3, -787.1 },
+        { 3726.3, 3776.2, 3510.9, 3777.3, 3969.4, 3377.7, 3762.9, 3849.5, 3948.3, 3690.8 },
+        0.8
+    };
+    LandmarkTable landmarks;
+    buildLandmarkTable(graph, 2, &landmarks);
+    Heuristic none = { HEURISTIC_NONE, NULL, NULL };
+    Heuristic geo = { HEURISTIC_COORDINATES, &coords, NULL };
+    Heuristic alt = { HEURISTIC_LANDMARKS, NULL, &landmarks };
+    int queries[2][2] = { { 0, 7 }, { 5, 8 } };
+    for (int q = 0; q < 2; q++) {
+        int src = queries[q][0], dest = queries[q][1];
+        int settled;
+        printf("%s -> %s\n", graph->cityNames[src], graph->cityNames[dest]);
+        Weight dist = astar(graph, src, dest, &none, NULL, NULL, &settled);
+        printf("  Dijkstra (arret anticipe) : %5" WEIGHT_FMT " km, %2d villes fixees\n",
+               WEIGHT_PRINT(dist), settled);
+        dist = bidirectionalDijkstra(graph, src, dest, NULL, NULL, &settled);
+        printf("  Bidirectionnel            : %5" WEIGHT_FMT " km, %2d villes fixees\n",
+               WEIGHT_PRINT(dist), settled);
+        dist = astar(graph, src, dest, &geo, NULL, NULL, &settled);
+        printf("  A* (coordonnees)          : %5" WEIGHT_FMT " km, %2d villes fixees\n",
+               WEIGHT_PRINT(dist), settled);
+        dist = astar(graph, src, dest, &alt, NULL, NULL, &settled);
+        printf("  A* (ALT, %d reperes)       : %5" WEIGHT_FMT " km, %2d villes fixees\n",
+               landmarks.numLandmarks, WEIGHT_PRINT(dist), settled);
+    }
+    printf("\n");
+}
 /**
  * Test de l'algorithme TSP Brute Force
  */
@@ -104,23 +149,24 @@ void testTSP(Graph* graph) {
     printf("|     TEST DU TSP (BRUTE FORCE)          |\n");
     printf("+========================================+\n\n");
     // Calculer les distances minimales
-    int distMatrix[MAX_CITIES][MAX_CITIES];
-    computeAllPairsShortestPaths(graph, distMatrix);
+    Weight distMatrix[MAX_CITIES][MAX_CITIES];
+    HopIndex nextHop[MAX_CITIES][MAX_CITIES];
+    computeAllPairsShortestPathsWithHops(graph, distMatrix, nextHop);
     // Afficher la matrice
     printf("Matrice des distances minimales :\n");
     printf("(calculees avec Dijkstra)\n\n");
     printf("%12s", "");
     for (int i = 0; i < graph->numCities; i++) {
-        printf("%6d", i);
+        printf("%*d", WEIGHT_WIDTH, i);
     }
     printf("\n");
     for (int i = 0; i < graph->numCities; i++) {
         printf("%10s: ", graph->cityNames[i]);
         for (int j = 0; j < graph->numCities; j++) {
             if (distMatrix[i][j] == INF) {
-                printf("%6s", "INF");
+                printf("%*s", WEIGHT_WIDTH, "INF");
             } else {
-                printf("%6d", distMatrix[i][j]);
+                printf("%*" WEIGHT_FMT, WEIGHT_WIDTH, WEIGHT_PRINT(distMatrix[i][j]));
             }
         }
         printf("\n");
@@ -129,13 +175,121 @@ void testTSP(Graph* graph) {
     printf("\n");
     TSPResult result = solveTSPBruteForce(distMatrix, graph->numCities, 0);
     displayTSPResult(&result, graph); // Afficher le résultat
+    // Itinéraire routier complet (sans relancer Dijkstra)
+    int roadPath[MAX_ROAD_PATH];
+    int roadLength = expandTourToRoadPath(&result, nextHop, roadPath, MAX_ROAD_PATH);
+    if (roadLength > 0) {
+        printf("Itineraire routier :\n  ");
+        for (int i = 0; i < roadLength; i++) {
+            printf("%s", graph->cityNames[roadPath[i]]);
+            if (i < roadLength - 1) printf(" -> ");
+        }
+        printf("\n");
+    }
+}
+/**
+ * Test de la résolution en lot
+ * Chaque instance est restreinte aux k premières villes du graphe
+ */
+void testBatch(Graph* graph) {
+    printf("\n");
+    printf("+========================================+\n");
+    printf("|     TEST DE LA RESOLUTION EN LOT       |\n");
+    printf("+========================================+\n\n");
+    Weight distMatrix[MAX_CITIES][MAX_CITIES];
+    computeAllPairsShortestPaths(graph, distMatrix);
+    int numInstances = graph->numCities - 3;
+    int totalCells = 0;
+    for (int k = 4; k <= graph->numCities; k++) {
+        totalCells += k * k;
+    }
+    TSPBatch* batch = createTSPBatch(numInstances, totalCells);
+    if (batch == NULL) return;
+    for (int k = 4; k <= graph->numCities; k++) {
+        addTSPBatchInstance(batch, distMatrix, k);
+    }
+    TSPResult results[MAX_CITIES];
+    solveTSPBatch(batch, results, 0);
+    for (int i = 0; i < batch->numInstances; i++) {
+        printf("%2d villes : ", batch->numCities[i]);
+        if (results[i].totalDistance == INF) {
+            printf("aucun tour\n");
+            continue;
+        }
+        printf("%5" WEIGHT_FMT " km  (", WEIGHT_PRINT(results[i].totalDistance));
+        for (int j = 0; j < results[i].tourLength; j++) {
+            printf("%d%s", results[i].tour[j],
+                   j < results[i].tourLength - 1 ? " " : ")\n");
+        }
+    }
+    freeTSPBatch(batch);
+}
+/**
+ * Test de la réoptimisation après modification du graphe
+ * Nouvelle route Tetouan - Oujda et retrait d'Agadir du tour
+ */
+void testReoptimization(Graph* graph) {
+    printf("\n");
+    printf("+========================================+\n");
+    printf("|     TEST DE LA REOPTIMISATION          |\n");
+    printf("+========================================+\n\n");
+    Weight distMatrix[MAX_CITIES][MAX_CITIES];
+    computeAllPairsShortestPaths(graph, distMatrix);
+    TSPResult previous = solveTSPExact(distMatrix, graph->numCities, 0);
+    printf("Tour initial : %" WEIGHT_FMT " km\n", WEIGHT_PRINT(previous.totalDistance));
+    // Modifications : la nouvelle route change de nombreuses distances
+    Weight oldMatrix[MAX_CITIES][MAX_CITIES];
+    memcpy(oldMatrix, distMatrix, sizeof(oldMatrix));
+    addEdge(graph, 8, 7, WEIGHT_FROM_INT(420));
+    computeAllPairsShortestPaths(graph, distMatrix);
+    TourChanges changes;
+    clearTourChanges(&changes);
+    int changed = addDistanceMatrixChanges(&changes, oldMatrix, distMatrix, graph->numCities);
+    addRemovedCity(&changes, 5);
+    printf("Nouvelle route Tetouan - Oujda (420 km) : %d distances modifiees\n", changed);
+    printf("Agadir retiree du tour\n");
+    TSPResult result = reoptimizeTour(&previous, distMatrix, graph->numCities, &changes);
+    displayTour(&result, graph);
+}
+/**
+ * Test du tour à deux niveaux
+ * Mouvement 2-opt sur le tour optimal, puis mouvement inverse
+ */
+void testTwoLevelTour(Graph* graph) {
+    printf("\n");
+    printf("+========================================+\n");
+    printf("|     TEST DU TOUR A DEUX NIVEAUX        |\n");
+    printf("+========================================+\n\n");
+    Weight distMatrix[MAX_CITIES][MAX_CITIES];
+    computeAllPairsShortestPaths(graph, distMatrix);
+    TSPResult result = solveTSPExact(distMatrix, graph->numCities, 0);
+    TwoLevelTour* tour = twoLevelTourFromResult(&result);
+    if (tour == NULL) return;
+    int from = result.tour[2];
+    int to = result.tour[5];
+    printf("Tour optimal : %" WEIGHT_FMT " km\n", WEIGHT_PRINT(result.totalDistance));
+    printf("%s entre %s et %s : %s\n", graph->cityNames[result.tour[3]],
+           graph->cityNames[from], graph->cityNames[to],
+           twoLevelBetween(tour, from, result.tour[3], to) ? "oui" : "non");
+    // 2-opt : inverser le trajet from -> to
+    twoLevelReverse(tour, from, to);
+    TSPResult moved;
+    twoLevelTourToResult(tour, result.tour[0], distMatrix, &moved);
+    printf("Apres inversion %s -> %s : %" WEIGHT_FMT " km\n",
+           graph->cityNames[from], graph->cityNames[to],
+           WEIGHT_PRINT(moved.totalDistance));
+    // Le mouvement inverse restaure le tour initial
+    twoLevelReverse(tour, to, from);
+    twoLevelTourToResult(tour, result.tour[0], distMatrix, &moved);
+    printf("Apres retour : %" WEIGHT_FMT " km\n", WEIGHT_PRINT(moved.totalDistance));
+    freeTwoLevelTour(tour);
 }
 /**
  * Menu interactif
  */
 void interactiveMenu(Graph* graph) {
     int choice;
-    int distMatrix[MAX_CITIES][MAX_CITIES];
+    Weight distMatrix[MAX_CITIES][MAX_CITIES];
     int distMatrixComputed = 0;
     do {
         printf("\n");
@@ -166,12 +320,12 @@ void interactiveMenu(Graph* graph) {
                 scanf("%d", &dest);
                 int path[MAX_CITIES];
                 int pathLength;
-                int dist = dijkstra(graph, src, dest, path, &pathLength);
+                Weight dist = dijkstra(graph, src, dest, path, &pathLength);
                 printf("\n--- Resultat ---\n");
                 if (dist == INF) {
                     printf("Aucun chemin trouve!\n");
                 } else {
-                    printf("Distance : %d km\n", dist);
+                    printf("Distance : %" WEIGHT_FMT " km\n", WEIGHT_PRINT(dist));
                     printf("Chemin : ");
                     for (int i = 0; i < pathLength; i++) {
                         printf("%s", graph->cityNames[path[i]]);
@@ -191,9 +345,17 @@ void interactiveMenu(Graph* graph) {
                     computeAllPairsShortestPaths(graph, distMatrix);
                     distMatrixComputed = 1;
                 }
-                TSPResult result = solveTSPBruteForce(distMatrix,
-                                                       graph->numCities,
-                                                       startCity);
+                TSPResult result;
+                if (graph->numCities <= BRUTE_FORCE_MAX_CITIES) {
+                    result = solveTSPBruteForce(distMatrix, graph->numCities,
+                                                startCity);
+                } else if (startCity < 0 || startCity >= graph->numCities) {
+                    printf("Ville de depart invalide\n");
+                    break;
+                } else {
+                    // Trop de villes : Held-Karp
+                    result = solveTSPExact(distMatrix, graph->numCities, startCity);
+                }
                 displayTSPResult(&result, graph);
                 break;
             }
@@ -205,7 +367,11 @@ void interactiveMenu(Graph* graph) {
                 scanf("%d", &dest);
                 printf("Distance (km) : ");
                 scanf("%d", &weight);
-                addEdge(graph, src, dest, weight);
+                if (weight < 0 || weight > WEIGHT_MAX_INT) {
+                    printf("Distance invalide (0-%d)\n", (int)WEIGHT_MAX_INT);
+                    break;
+                }
+                addEdge(graph, src, dest, WEIGHT_FROM_INT(weight));
                 distMatrixComputed = 0;
                 printf("Route ajoutee!\n");
                 break;
@@ -237,7 +403,11 @@ int main() {
     printf("Graphe cree avec succes!\n");
     displayGraph(graph);    // Afficher le graphe
     testDijkstra(graph);     // Tester Dijkstra
+    testGoalDirected(graph); // Tester A*, ALT et bidirectionnel
     testTSP(graph);     // Tester TSP
+    testBatch(graph);   // Tester la résolution en lot
+    testTwoLevelTour(graph); // Tester le tour à deux niveaux
+    testReoptimization(graph); // Tester la réoptimisation (modifie le graphe)
     // Menu interactif (décommenter pour activer)
     // interactiveMenu(graph);
     freeGraph(graph); // Libérer la mémoire
@@ -0,0 +1,319 @@
+/**
+ * Implémentation de la réoptimisation locale d'un tour
+ */
+#include "reopt.h"
+#include <string.h>
+// ══════════════════════════════════════════════════════════════════
+// TOUR DE TRAVAIL
+// ══════════════════════════════════════════════════════════════════
+typedef struct {
+    int cities[MAX_CITIES];     // Tour cyclique (sans le retour)
+    int count;                  // Nombre de villes dans le tour
+    int position[MAX_CITIES];   // Position de chaque ville (-1 : absente)
+    int active[MAX_CITIES];     // Villes autour desquelles chercher
+    int numCities;              // Nombre de villes du graphe
+} WorkTour;
+
+/**
+ * Détour a -> city -> b à la place de a -> b, gardé sous forme
+ * (entrée, sortie) : les comparaisons n'additionnent que des Weight
+ * positifs, sans soustraction (Weight peut être non signé)
+ */
+typedef struct {
+    Weight in;      // d(a, city) + d(city, b)
+    Weight out;     // d(a, b)
+} Detour;
+
+static Detour detour(Weight distMatrix[MAX_CITIES][MAX_CITIES], int a, int city, int b) {
+    Detour result;
+    result.in = addWeights(distMatrix[a][city], distMatrix[city][b]);
+    result.out = distMatrix[a][b];
+    return result;
+}
+
+/**
+ * Vrai si le détour x coûte moins que y : x.in - x.out < y.in - y.out
+ */
+static int cheaperDetour(Detour x, Detour y) {
+    return addWeights(x.in, y.out) < addWeights(y.in, x.out);
+}
+
+static void refreshPositions(WorkTour* t) {
+    for (int i = 0; i < t->numCities; i++) {
+        t->position[i] = -1;
+    }
+    for (int i = 0; i < t->count; i++) {
+        t->position[t->cities[i]] = i;
+    }
+}
+
+static void activate(WorkTour* t, int city) {
+    if (city >= 0 && city < t->numCities && t->position[city] != -1) {
+        t->active[city] = 1;
+    }
+}
+
+/**
+ * Retire la ville en position p ; ses deux voisines deviennent actives
+ */
+static void removeAt(WorkTour* t, int p) {
+    int m = t->count;
+    int prev = t->cities[(p + m - 1) % m];
+    int next = t->cities[(p + 1) % m];
+    t->active[t->cities[p]] = 0;
+    memmove(&t->cities[p], &t->cities[p + 1], sizeof(int) * (m - p - 1));
+    t->count--;
+    refreshPositions(t);
+    if (t->count > 0) {
+        activate(t, prev);
+        activate(t, next);
+    }
+}
+
+/**
+ * Insère city juste après la position p
+ */
+static void insertAfter(WorkTour* t, int p, int city) {
+    memmove(&t->cities[p + 2], &t->cities[p + 1], sizeof(int) * (t->count - p - 1));
+    t->cities[p + 1] = city;
+    t->count++;
+    refreshPositions(t);
+}
+
+/**
+ * Position p minimisant le surcoût d'insertion entre p et p + 1
+ */
+static int cheapestInsertion(WorkTour* t, Weight distMatrix[MAX_CITIES][MAX_CITIES],
+                             int city) {
+    int m = t->count;
+    int bestPos = 0;
+    Detour best = detour(distMatrix, t->cities[0], city, t->cities[1 % m]);
+    for (int p = 1; p < m; p++) {
+        Detour added = detour(distMatrix, t->cities[p], city, t->cities[(p + 1) % m]);
+        if (cheaperDetour(added, best)) {
+            best = added;
+            bestPos = p;
+        }
+    }
+    return bestPos;
+}
+// ══════════════════════════════════════════════════════════════════
+// MOUVEMENTS LOCAUX
+// ══════════════════════════════════════════════════════════════════
+/**
+ * 2-opt autour de city : remplace l'une de ses deux arêtes et une autre
+ * arête (a,b),(c,d) par (a,c),(b,d) en inversant le segment b..c
+ */
+static int tryTwoOpt(WorkTour* t, Weight distMatrix[MAX_CITIES][MAX_CITIES], int city) {
+    int m = t->count;
+    if (m < 4) return 0;
+    int p = t->position[city];
+    int ownEdges[2] = { (p + m - 1) % m, p };
+
+    for (int k = 0; k < 2; k++) {
+        int e1 = ownEdges[k];
+        for (int e2 = 0; e2 < m; e2++) {
+            if (e2 == e1 || e2 == (e1 + 1) % m || e1 == (e2 + 1) % m) continue;
+            int i = (e1 < e2) ? e1 : e2;
+            int j = (e1 < e2) ? e2 : e1;
+            int a = t->cities[i];
+            int b = t->cities[i + 1];
+            int c = t->cities[j];
+            int d = t->cities[(j + 1) % m];
+            if (addWeights(distMatrix[a][c], distMatrix[b][d]) <
+                addWeights(distMatrix[a][b], distMatrix[c][d])) {
+                for (int lo = i + 1, hi = j; lo < hi; lo++, hi--) {
+                    swap(&t->cities[lo], &t->cities[hi]);
+                }
+                refreshPositions(t);
+                activate(t, a);
+                activate(t, b);
+                activate(t, c);
+                activate(t, d);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * Or-opt : déplace city vers l'arête où elle coûte le moins
+ */
+static int tryOrOpt(WorkTour* t, Weight distMatrix[MAX_CITIES][MAX_CITIES], int city) {
+    int m = t->count;
+    if (m < 4) return 0;
+    int p = t->position[city];
+    int prev = t->cities[(p + m - 1) % m];
+    int next = t->cities[(p + 1) % m];
+
+    // Le détour actuel sert de référence à battre
+    int bestFrom = -1;
+    Detour bestAdded = detour(distMatrix, prev, city, next);
+    for (int e = 0; e < m; e++) {
+        int x = t->cities[e];
+        int y = t->cities[(e + 1) % m];
+        if (x == city || y == city) continue;
+        Detour added = detour(distMatrix, x, city, y);
+        if (cheaperDetour(added, bestAdded)) {
+            bestAdded = added;
+            bestFrom = x;
+        }
+    }
+    if (bestFrom == -1) return 0;
+
+    removeAt(t, p);
+    insertAfter(t, t->position[bestFrom], city);
+    activate(t, city);
+    return 1;
+}
+// ══════════════════════════════════════════════════════════════════
+// FONCTION PRINCIPALE
+// ══════════════════════════════════════════════════════════════════
+void clearTourChanges(TourChanges* changes) {
+    if (changes == NULL) return;
+    changes->numChangedEdges = 0;
+    changes->numInserted = 0;
+    changes->numRemoved = 0;
+}
+
+int addChangedEdge(TourChanges* changes, int a, int b) {
+    if (changes == NULL || changes->numChangedEdges >= MAX_EDGE_CHANGES ||
+        a < 0 || a >= MAX_CITIES || b < 0 || b >= MAX_CITIES) {
+        return 0;
+    }
+    changes->changedEdges[changes->numChangedEdges][0] = a;
+    changes->changedEdges[changes->numChangedEdges][1] = b;
+    changes->numChangedEdges++;
+    return 1;
+}
+
+int addInsertedCity(TourChanges* changes, int city) {
+    if (changes == NULL || changes->numInserted >= MAX_CITIES ||
+        city < 0 || city >= MAX_CITIES) {
+        return 0;
+    }
+    changes->inserted[changes->numInserted++] = city;
+    return 1;
+}
+
+int addRemovedCity(TourChanges* changes, int city) {
+    if (changes == NULL || changes->numRemoved >= MAX_CITIES ||
+        city < 0 || city >= MAX_CITIES) {
+        return 0;
+    }
+    changes->removed[changes->numRemoved++] = city;
+    return 1;
+}
+
+int addDistanceMatrixChanges(TourChanges* changes,
+                             Weight oldMatrix[MAX_CITIES][MAX_CITIES],
+                             Weight newMatrix[MAX_CITIES][MAX_CITIES],
+                             int numCities) {
+    if (changes == NULL || numCities <= 0 || numCities > MAX_CITIES) {
+        return -1;
+    }
+    int added = 0;
+    for (int i = 0; i < numCities; i++) {
+        for (int j = i + 1; j < numCities; j++) {
+            if (oldMatrix[i][j] == newMatrix[i][j] &&
+                oldMatrix[j][i] == newMatrix[j][i]) {
+                continue;
+            }
+            if (!addChangedEdge(changes, i, j)) return -1;
+            added++;
+        }
+    }
+    return added;
+}
+
+TSPResult reoptimizeTour(TSPResult* previous,
+                         Weight distMatrix[MAX_CITIES][MAX_CITIES],
+                         int numCities,
+                         const TourChanges* changes) {
+    TSPResult result;
+    if (numCities <= 0 || numCities > MAX_CITIES) {
+        result.totalDistance = INF;
+        result.tourLength = 0;
+        return result;
+    }
+
+    WorkTour t;
+    t.numCities = numCities;
+    t.count = 0;
+    for (int i = 0; i < numCities; i++) {
+        t.position[i] = -1;
+        t.active[i] = 0;
+    }
+
+    // Reprendre le tour précédent (sans la ville de retour)
+    if (previous != NULL) {
+        for (int i = 0; i < previous->tourLength - 1; i++) {
+            int city = previous->tour[i];
+            if (city >= 0 && city < numCities && t.position[city] == -1) {
+                t.position[city] = t.count;
+                t.cities[t.count++] = city;
+            }
+        }
+    }
+    int startCity = (t.count > 0) ? t.cities[0] : -1;
+
+    if (changes != NULL) {
+        // ÉTAPE 1 : Retraits
+        for (int k = 0; k < changes->numRemoved; k++) {
+            int city = changes->removed[k];
+            if (city >= 0 && city < numCities && t.position[city] != -1) {
+                removeAt(&t, t.position[city]);
+            }
+        }
+        // ÉTAPE 2 : Insertions au moindre coût
+        for (int k = 0; k < changes->numInserted; k++) {
+            int city = changes->inserted[k];
+            if (city < 0 || city >= numCities || t.position[city] != -1) continue;
+            if (t.count == 0) {
+                t.cities[t.count++] = city;
+                refreshPositions(&t);
+            } else {
+                insertAfter(&t, cheapestInsertion(&t, distMatrix, city), city);
+            }
+            activate(&t, city);
+        }
+        // Toute ville du tour dont une distance a changé devient active
+        for (int k = 0; k < changes->numChangedEdges; k++) {
+            activate(&t, changes->changedEdges[k][0]);
+            activate(&t, changes->changedEdges[k][1]);
+        }
+    }
+
+    // ÉTAPE 3 : Amélioration locale tant qu'une ville est active
+    int found = 1;
+    while (found) {
+        found = 0;
+        for (int city = 0; city < numCities; city++) {
+            if (!t.active[city]) continue;
+            found = 1;
+            t.active[city] = 0;
+            if (!tryTwoOpt(&t, distMatrix, city)) {
+                tryOrOpt(&t, distMatrix, city);
+            }
+        }
+    }
+
+    // Remettre la ville de départ en tête
+    if (t.count == 0) {
+        result.totalDistance = 0;
+        result.tourLength = 0;
+        return result;
+    }
+    if (startCity == -1 || t.position[startCity] == -1) {
+        startCity = t.cities[0];
+    }
+    int offset = t.position[startCity];
+    for (int i = 0; i < t.count; i++) {
+        result.tour[i] = t.cities[(offset + i) % t.count];
+    }
+    result.tour[t.count] = startCity;
+    result.tourLength = t.count + 1;
+    result.totalDistance = calculateTourDistance(result.tour, t.count, distMatrix);
+    return result;
+}
@@ -0,0 +1,91 @@
+/**
+ *      Réoptimisation d'un tour existant après modification du graphe
+ */
+#ifndef REOPT_H
+#define REOPT_H
+#include "tsp.h"
+// ══════════════════════════════════════════════════════════════════
+// CONSTANTES
+// ══════════════════════════════════════════════════════════════════
+#define MAX_EDGE_CHANGES (MAX_CITIES * MAX_CITIES)
+// ══════════════════════════════════════════════════════════════════
+// STRUCTURES DE DONNÉES
+// ══════════════════════════════════════════════════════════════════
+/**
+ * Modifications survenues depuis le calcul du tour précédent
+ * changedEdges : paires de villes dont la distance a changé dans
+ *                distMatrix. Une route modifiée change en général la
+ *                distance de nombreuses paires : utiliser
+ *                addDistanceMatrixChanges plutôt que ses seules extrémités
+ * inserted     : nouvelles villes à visiter
+ * removed      : villes à retirer du tour
+ */
+typedef struct {
+    int numChangedEdges;
+    int changedEdges[MAX_EDGE_CHANGES][2];
+    int numInserted;
+    int inserted[MAX_CITIES];
+    int numRemoved;
+    int removed[MAX_CITIES];
+} TourChanges;
+
+// ══════════════════════════════════════════════════════════════════
+// PROTOTYPES DES FONCTIONS
+// ══════════════════════════════════════════════════════════════════
+
+/**
+ * Réinitialise une liste de modifications
+ * @param changes : la liste à vider
+ */
+void clearTourChanges(TourChanges* changes);
+/**
+ * Ajoute une paire de villes dont la distance a changé
+ * @param changes : la liste des modifications
+ * @param a, b : les deux villes
+ * @return : 1 en cas de succès, 0 si la liste est pleine ou la paire invalide
+ */
+int addChangedEdge(TourChanges* changes, int a, int b);
+/**
+ * Ajoute une ville à insérer dans le tour
+ * @return : 1 en cas de succès, 0 si la liste est pleine ou la ville invalide
+ */
+int addInsertedCity(TourChanges* changes, int city);
+/**
+ * Ajoute une ville à retirer du tour
+ * @return : 1 en cas de succès, 0 si la liste est pleine ou la ville invalide
+ */
+int addRemovedCity(TourChanges* changes, int city);
+/**
+ * Compare deux matrices des distances (avant et après modification du
+ * graphe) et ajoute chaque paire dont la distance a changé
+ * @param changes : la liste des modifications
+ * @param oldMatrix : matrice utilisée pour le tour précédent
+ * @param newMatrix : matrice à jour
+ * @param numCities : nombre de villes du graphe
+ * @return : nombre de paires ajoutées, -1 si la liste est pleine
+ */
+int addDistanceMatrixChanges(TourChanges* changes,
+                             Weight oldMatrix[MAX_CITIES][MAX_CITIES],
+                             Weight newMatrix[MAX_CITIES][MAX_CITIES],
+                             int numCities);
+/**
+ * Répare localement un tour au lieu de tout recalculer
+ * 1. Retire les villes supprimées (leurs voisines deviennent actives)
+ * 2. Insère chaque nouvelle ville à la position la moins coûteuse
+ * 3. Applique 2-opt et Or-opt autour des villes actives uniquement
+ *    (villes insérées, voisines des villes retirées, et villes du tour
+ *    dont une distance vers une autre ville a changé),
+ *    jusqu'à ce qu'aucun mouvement n'améliore le tour
+ * Le tour garde sa ville de départ si elle n'a pas été retirée.
+ * Les distances sont supposées symétriques (graphe non orienté).
+ * @param previous : tour précédent (peut être NULL : tour vide)
+ * @param distMatrix : matrice des distances à jour
+ * @param numCities : nombre de villes du graphe
+ * @param changes : modifications à prendre en compte
+ * @return : tour mis à jour (non forcément optimal)
+ */
+TSPResult reoptimizeTour(TSPResult* previous,
+                         Weight distMatrix[MAX_CITIES][MAX_CITIES],
+                         int numCities,
+                         const TourChanges* changes);
+#endif // REOPT_H
@@ -0,0 +1,337 @@
+/**
+ *                          SEARCH.C
+ *       Recherche orientée vers la cible (A*, ALT, bidirectionnel)
+ */
+
+#include "search.h"
+#include <math.h>
+
+// ══════════════════════════════════════════════════════════════════
+// FONCTIONS AUXILIAIRES
+// ══════════════════════════════════════════════════════════════════
+
+/**
+ * Dijkstra complet depuis src (ou vers src si reverse = 1)
+ * Sert uniquement au précalcul des repères.
+ */
+static void shortestPathTree(Graph* graph, int src, int reverse, Weight* dist) {
+    int numCities = graph->numCities;
+    int visited[MAX_CITIES];
+
+    for (int i = 0; i < numCities; i++) {
+        dist[i] = INF;
+        visited[i] = 0;
+    }
+    dist[src] = 0;
+
+    for (int count = 0; count < numCities; count++) {
+        int u = -1;
+        for (int v = 0; v < numCities; v++) {
+            if (!visited[v] && dist[v] != INF && (u == -1 || dist[v] < dist[u])) {
+                u = v;
+            }
+        }
+        if (u == -1) break;
+        visited[u] = 1;
+
+        for (int v = 0; v < numCities; v++) {
+            Weight w = reverse ? graph->adjMatrix[v][u] : graph->adjMatrix[u][v];
+            Weight candidate = addWeights(dist[u], w);
+            if (!visited[v] && candidate < dist[v]) {
+                dist[v] = candidate;
+            }
+        }
+    }
+}
+
+/**
+ * Estimation (minorant) de la distance restante de v jusqu'à dest
+ */
+static Weight estimate(const Heuristic* heuristic, int v, int dest) {
+    if (heuristic == NULL) return 0;
+
+    if (heuristic->type == HEURISTIC_COORDINATES && heuristic->coords != NULL) {
+        const CityCoordinates* c = heuristic->coords;
+        double dx = c->x[v] - c->x[dest];
+        double dy = c->y[v] - c->y[dest];
+        return WEIGHT_FROM_DOUBLE(c->scale * sqrt(dx * dx + dy * dy));
+    }
+
+    if (heuristic->type == HEURISTIC_LANDMARKS && heuristic->landmarks != NULL) {
+        // Inégalité triangulaire :
+        //   d(v,t) >= d(v,L) - d(t,L)   et   d(v,t) >= d(L,t) - d(L,v)
+        // (soustraction seulement si positive : Weight peut être non signé)
+        const LandmarkTable* t = heuristic->landmarks;
+        Weight best = 0;
+        for (int l = 0; l < t->numLandmarks; l++) {
+            Weight toV = t->distTo[l][v], toDest = t->distTo[l][dest];
+            Weight fromV = t->distFrom[l][v], fromDest = t->distFrom[l][dest];
+            if (toV != INF && toDest != INF && toV > toDest &&
+                toV - toDest > best) {
+                best = toV - toDest;
+            }
+            if (fromDest != INF && fromV != INF && fromDest > fromV &&
+                fromDest - fromV > best) {
+                best = fromDest - fromV;
+            }
+        }
+        return best;
+    }
+
+    return 0;
+}
+
+/**
+ * Reconstruit le chemin src -> dest à partir du tableau des prédécesseurs
+ */
+static void buildPath(int* parent, int dest, int* path, int* pathLength) {
+    int len = 0;
+    int current = dest;
+    while (current != -1) {
+        len++;
+        current = parent[current];
+    }
+
+    *pathLength = len;
+    current = dest;
+    for (int i = len - 1; i >= 0; i--) {
+        path[i] = current;
+        current = parent[current];
+    }
+}
+
+// ══════════════════════════════════════════════════════════════════
+// POINTS DE REPÈRE (ALT)
+// ══════════════════════════════════════════════════════════════════
+
+/**
+ * Choix des repères par la méthode du plus éloigné
+ *
+ * Fonctionnement :
+ * 1. Premier repère : la ville la plus éloignée de la ville 0
+ * 2. Repère suivant : la ville qui maximise la distance minimale
+ *    aux repères déjà choisis
+ * 3. Pour chaque repère, Dijkstra complet dans les deux sens
+ */
+int buildLandmarkTable(Graph* graph, int numLandmarks, LandmarkTable* table) {
+    if (graph == NULL || table == NULL) return 0;
+    if (numLandmarks > MAX_LANDMARKS) numLandmarks = MAX_LANDMARKS;
+    if (numLandmarks > graph->numCities) numLandmarks = graph->numCities;
+
+    int numCities = graph->numCities;
+    Weight nearest[MAX_CITIES]; // Distance au repère le plus proche
+    Weight fromZero[MAX_CITIES];
+
+    shortestPathTree(graph, 0, 0, fromZero);
+    for (int v = 0; v < numCities; v++) {
+        nearest[v] = fromZero[v];
+    }
+
+    table->numLandmarks = 0;
+    for (int l = 0; l < numLandmarks; l++) {
+        // Ville atteignable la plus éloignée des repères existants
+        int candidate = -1;
+        for (int v = 0; v < numCities; v++) {
+            if (nearest[v] != INF && (candidate == -1 || nearest[v] > nearest[candidate])) {
+                candidate = v;
+            }
+        }
+        if (candidate == -1 || (l > 0 && nearest[candidate] == 0)) break;
+
+        table->landmarks[l] = candidate;
+        shortestPathTree(graph, candidate, 0, table->distFrom[l]);
+        shortestPathTree(graph, candidate, 1, table->distTo[l]);
+        table->numLandmarks++;
+
+        for (int v = 0; v < numCities; v++) {
+            if (table->distFrom[l][v] < nearest[v]) {
+                nearest[v] = table->distFrom[l][v];
+            }
+        }
+    }
+
+    return table->numLandmarks;
+}
+
+// ══════════════════════════════════════════════════════════════════
+// ALGORITHME A*
+// ══════════════════════════════════════════════════════════════════
+
+/**
+ * A* - Dijkstra guidé par une heuristique
+ *
+ * PRINCIPE :
+ * 1. Comme Dijkstra, mais on fixe le sommet minimisant g(u) + h(u)
+ *    où g est la distance depuis src et h un minorant de d(u, dest)
+ * 2. On s'arrête dès que dest est fixée
+ *
+ * Les heuristiques fournies sont cohérentes : un sommet fixé
+ * n'est jamais réouvert.
+ */
+Weight astar(Graph* graph, int src, int dest, const Heuristic* heuristic,
+             int* path, int* pathLength, int* settled) {
+    if (settled != NULL) *settled = 0;
+    if (graph == NULL || src < 0 || src >= graph->numCities ||
+        dest < 0 || dest >= graph->numCities) {
+        if (pathLength != NULL) *pathLength = 0;
+        return INF;
+    }
+
+    int numCities = graph->numCities;
+    Weight dist[MAX_CITIES];   // g : distance depuis la source
+    Weight h[MAX_CITIES];      // Estimation vers la destination
+    int estimated[MAX_CITIES]; // h déjà calculée ?
+    int visited[MAX_CITIES];
+    int parent[MAX_CITIES];
+    int count = 0;
+
+    for (int i = 0; i < numCities; i++) {
+        dist[i] = INF;
+        estimated[i] = 0;
+        visited[i] = 0;
+        parent[i] = -1;
+    }
+    dist[src] = 0;
+    h[src] = estimate(heuristic, src, dest);
+    estimated[src] = 1;
+
+    while (1) {
+        // Sommet ouvert de clé g + h minimale
+        int u = -1;
+        Weight bestKey = 0;
+        for (int v = 0; v < numCities; v++) {
+            if (visited[v] || dist[v] == INF) continue;
+            Weight key = addWeights(dist[v], h[v]);
+            if (u == -1 || key < bestKey) {
+                u = v;
+                bestKey = key;
+            }
+        }
+        if (u == -1) break;
+
+        visited[u] = 1;
+        count++;
+        if (u == dest) break;   // Arrêt anticipé
+
+        for (int v = 0; v < numCities; v++) {
+            Weight candidate = addWeights(dist[u], graph->adjMatrix[u][v]);
+            if (!visited[v] && candidate < dist[v]) {
+                dist[v] = candidate;
+                parent[v] = u;
+                if (!estimated[v]) {
+                    h[v] = estimate(heuristic, v, dest);
+                    estimated[v] = 1;
+                }
+            }
+        }
+    }
+
+    if (settled != NULL) *settled = count;
+    if (path != NULL && pathLength != NULL && dist[dest] != INF) {
+        buildPath(parent, dest, path, pathLength);
+    } else if (pathLength != NULL) {
+        *pathLength = 0;
+    }
+
+    return dist[dest];
+}
+
+// ══════════════════════════════════════════════════════════════════
+// DIJKSTRA BIDIRECTIONNEL
+// ══════════════════════════════════════════════════════════════════
+
+static int findMinOpen(Weight* dist, int* visited, int numCities) {
+    int minIndex = -1;
+    for (int v = 0; v < numCities; v++) {
+        if (!visited[v] && dist[v] != INF &&
+            (minIndex == -1 || dist[v] < dist[minIndex])) {
+            minIndex = v;
+        }
+    }
+    return minIndex;
+}
+
+/**
+ * Dijkstra bidirectionnel
+ *
+ * PRINCIPE :
+ * 1. Un front avance depuis src (arêtes u -> v), l'autre depuis dest
+ *    (arêtes v -> u) ; on développe le front de plus petite distance
+ * 2. Chaque fois qu'un sommet est atteint par les deux fronts, on met
+ *    à jour la meilleure distance connue (best) et le point de jonction
+ * 3. Arrêt dès que min(front avant) + min(front arrière) >= best
+ */
+Weight bidirectionalDijkstra(Graph* graph, int src, int dest,
+                             int* path, int* pathLength, int* settled) {
+    if (settled != NULL) *settled = 0;
+    if (graph == NULL || src < 0 || src >= graph->numCities ||
+        dest < 0 || dest >= graph->numCities) {
+        if (pathLength != NULL) *pathLength = 0;
+        return INF;
+    }
+
+    int numCities = graph->numCities;
+    Weight distF[MAX_CITIES], distB[MAX_CITIES];
+    int visitedF[MAX_CITIES], visitedB[MAX_CITIES];
+    int parentF[MAX_CITIES], parentB[MAX_CITIES];
+    Weight best = (src == dest) ? 0 : INF;
+    int meet = (src == dest) ? src : -1;
+    int count = 0;
+
+    for (int i = 0; i < numCities; i++) {
+        distF[i] = distB[i] = INF;
+        visitedF[i] = visitedB[i] = 0;
+        parentF[i] = parentB[i] = -1;
+    }
+    distF[src] = 0;
+    distB[dest] = 0;
+
+    while (1) {
+        int uF = findMinOpen(distF, visitedF, numCities);
+        int uB = findMinOpen(distB, visitedB, numCities);
+        if (uF == -1 || uB == -1) break;
+        if (addWeights(distF[uF], distB[uB]) >= best) break;
+
+        count++;
+        if (distF[uF] <= distB[uB]) {
+            visitedF[uF] = 1;
+            for (int v = 0; v < numCities; v++) {
+                Weight candidate = addWeights(distF[uF], graph->adjMatrix[uF][v]);
+                if (visitedF[v] || candidate >= distF[v]) continue;
+                distF[v] = candidate;
+                parentF[v] = uF;
+                if (addWeights(distF[v], distB[v]) < best) {
+                    best = distF[v] + distB[v];
+                    meet = v;
+                }
+            }
+        } else {
+            visitedB[uB] = 1;
+            for (int v = 0; v < numCities; v++) {
+                Weight candidate = addWeights(distB[uB], graph->adjMatrix[v][uB]);
+                if (visitedB[v] || candidate >= distB[v]) continue;
+                distB[v] = candidate;
+                parentB[v] = uB;
+                if (addWeights(distF[v], distB[v]) < best) {
+                    best = distF[v] + distB[v];
+                    meet = v;
+                }
+            }
+        }
+    }
+
+    if (settled != NULL) *settled = count;
+    if (path != NULL && pathLength != NULL && best != INF) {
+        // Partie avant : src -> meet, puis partie arrière : meet -> dest
+        buildPath(parentF, meet, path, pathLength);
+        int current = parentB[meet];
+        while (current != -1) {
+            path[(*pathLength)++] = current;
+            current = parentB[current];
+        }
+    } else if (pathLength != NULL) {
+        *pathLength = 0;
+    }
+
+    return best;
+}
@@ -0,0 +1,94 @@
+/**
+ *      Recherche orientée vers la cible : bidirectionnelle, A* et ALT
+ */
+#ifndef SEARCH_H
+#define SEARCH_H
+#include "graph.h"
+// ══════════════════════════════════════════════════════════════════
+// CONSTANTES
+// ══════════════════════════════════════════════════════════════════
+#define MAX_LANDMARKS 4     // Nombre maximum de points de repère (ALT)
+// ══════════════════════════════════════════════════════════════════
+// STRUCTURES DE DONNÉES
+// ══════════════════════════════════════════════════════════════════
+/**
+ * Coordonnées des villes pour l'heuristique géométrique
+ * scale doit garantir scale × distance euclidienne <= distance routière
+ * (heuristique admissible), par exemple le nombre de km par unité.
+ */
+typedef struct {
+    double x[MAX_CITIES];
+    double y[MAX_CITIES];
+    double scale;
+} CityCoordinates;
+
+/**
+ * Table des distances vers et depuis quelques points de repère
+ * distFrom[l][v] : distance du repère l vers la ville v
+ * distTo[l][v]   : distance de la ville v vers le repère l
+ */
+typedef struct {
+    int numLandmarks;
+    int landmarks[MAX_LANDMARKS];
+    Weight distFrom[MAX_LANDMARKS][MAX_CITIES];
+    Weight distTo[MAX_LANDMARKS][MAX_CITIES];
+} LandmarkTable;
+
+typedef enum {
+    HEURISTIC_NONE,         // Dijkstra avec arrêt anticipé
+    HEURISTIC_COORDINATES,  // A* avec distance à vol d'oiseau
+    HEURISTIC_LANDMARKS     // A* avec repères et inégalité triangulaire
+} HeuristicType;
+
+/**
+ * Heuristique utilisée par A*
+ * Seul le champ correspondant à type doit être renseigné.
+ */
+typedef struct {
+    HeuristicType type;
+    const CityCoordinates* coords;
+    const LandmarkTable* landmarks;
+} Heuristic;
+
+// ══════════════════════════════════════════════════════════════════
+// PROTOTYPES DES FONCTIONS
+// ══════════════════════════════════════════════════════════════════
+
+/**
+ * Précalcule les distances vers et depuis des repères choisis par
+ * la méthode du plus éloigné (chaque repère maximise sa distance
+ * aux repères déjà choisis)
+ * @param graph : le graphe
+ * @param numLandmarks : nombre de repères voulus (<= MAX_LANDMARKS)
+ * @param table : table à remplir
+ * @return : nombre de repères effectivement retenus
+ */
+int buildLandmarkTable(Graph* graph, int numLandmarks, LandmarkTable* table);
+/**
+ * Algorithme A* - plus court chemin guidé par une heuristique
+ * S'arrête dès que dest est fixée.
+ * @param graph : le graphe
+ * @param src : ville de départ
+ * @param dest : ville d'arrivée
+ * @param heuristic : heuristique admissible (NULL : aucune)
+ * @param path : tableau pour stocker le chemin (peut être NULL)
+ * @param pathLength : longueur du chemin trouvé
+ * @param settled : nombre de villes fixées (peut être NULL)
+ * @return : distance minimale entre src et dest
+ */
+Weight astar(Graph* graph, int src, int dest, const Heuristic* heuristic,
+             int* path, int* pathLength, int* settled);
+/**
+ * Dijkstra bidirectionnel - recherche simultanée depuis src et dest
+ * S'arrête dès que les deux fronts garantissent l'optimalité.
+ * @param graph : le graphe
+ * @param src : ville de départ
+ * @param dest : ville d'arrivée
+ * @param path : tableau pour stocker le chemin (peut être NULL)
+ * @param pathLength : longueur du chemin trouvé
+ * @param settled : nombre de villes fixées (peut être NULL)
+ * @return : distance minimale entre src et dest
+ */
+Weight bidirectionalDijkstra(Graph* graph, int src, int dest,
+                             int* path, int* pathLength, int* settled);
+#endif // SEARCH_H
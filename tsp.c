@@ -6,9 +6,9 @@
 // ══════════════════════════════════════════════════════════════════
 // VARIABLES GLOBALES POUR L'ALGORITHME BRUTE FORCE
 // ══════════════════════════════════════════════════════════════════
-static int bestDistance;                    // Meilleure distance trouvée
+static Weight bestDistance;                 // Meilleure distance trouvée
 static int bestTour[MAX_CITIES + 1];        // Meilleur tour trouvé
-static int (*globalDistMatrix)[MAX_CITIES]; // Pointeur vers la matrice
+static Weight (*globalDistMatrix)[MAX_CITIES]; // Pointeur vers la matrice
 static int globalNumCities;                 // Nombre de villes
 // ══════════════════════════════════════════════════════════════════
 // FONCTIONS UTILITAIRES
@@ -24,26 +24,19 @@ void swap(int* a, int* b) {
 /**
  * Calcule la distance totale d'un tour
  */
-int calculateTourDistance(int* tour, int tourLength, int distMatrix[MAX_CITIES][MAX_CITIES]) {
-    int totalDistance = 0;
+Weight calculateTourDistance(int* tour, int tourLength, Weight distMatrix[MAX_CITIES][MAX_CITIES]) {
+    Weight totalDistance = 0;
     // Additionner les distances entre villes consécutives
+    // (une étape INF sature la somme à INF, sans test dans la boucle)
     for (int i = 0; i < tourLength - 1; i++) {
         int from = tour[i];
         int to = tour[i + 1];
-
-        if (distMatrix[from][to] == INF) {
-            return INF;
-        }
-        totalDistance += distMatrix[from][to];
+        totalDistance = addWeights(totalDistance, distMatrix[from][to]);
     }
     // Ajouter le retour à la ville de départ
     int lastCity = tour[tourLength - 1];
     int firstCity = tour[0];
-    if (distMatrix[lastCity][firstCity] == INF) {
-        return INF;
-    }
-    totalDistance += distMatrix[lastCity][firstCity];
-    return totalDistance;
+    return addWeights(totalDistance, distMatrix[lastCity][firstCity]);
 }
 // ══════════════════════════════════════════════════════════════════
 // ALGORITHME DE PERMUTATION (RÉCURSIF)
@@ -51,7 +44,7 @@ int calculateTourDistance(int* tour, int tourLength, int distMatrix[MAX_CITIES][
 static void permute(int* cities, int start, int end) {
     // CAS DE BASE : permutation complète
     if (start == end) {
-        int distance = calculateTourDistance(cities, globalNumCities, globalDistMatrix);
+        Weight distance = calculateTourDistance(cities, globalNumCities, globalDistMatrix);
         if (distance < bestDistance) {
             bestDistance = distance;
             for (int i = 0; i < globalNumCities; i++) {
@@ -71,7 +64,7 @@ static void permute(int* cities, int start, int end) {
 // ══════════════════════════════════════════════════════════════════
 // FONCTION PRINCIPALE TSP
 // ══════════════════════════════════════════════════════════════════
-TSPResult solveTSPBruteForce(int distMatrix[MAX_CITIES][MAX_CITIES],
+TSPResult solveTSPBruteForce(Weight distMatrix[MAX_CITIES][MAX_CITIES],
                               int numCities,
                               int startCity) {
     TSPResult result;
@@ -82,6 +75,13 @@ TSPResult solveTSPBruteForce(int distMatrix[MAX_CITIES][MAX_CITIES],
         result.tourLength = 0;
         return result;
     }
+    if (numCities > BRUTE_FORCE_MAX_CITIES) {
+        printf("Erreur: trop de villes pour le Brute Force (max %d)\n",
+               BRUTE_FORCE_MAX_CITIES);
+        result.totalDistance = INF;
+        result.tourLength = 0;
+        return result;
+    }
     // Cas trivial : une seule ville
     if (numCities == 1) {
         result.tour[0] = startCity;
@@ -124,6 +124,25 @@ TSPResult solveTSPBruteForce(int distMatrix[MAX_CITIES][MAX_CITIES],
     }
     return result;
 }
+/**
+ * Affiche la liste des villes d'un tour
+ */
+static void printTourCities(TSPResult* result, Graph* graph) {
+    for (int i = 0; i < result->tourLength; i++) {
+        int cityIndex = result->tour[i];
+        if (graph != NULL) {
+            printf("  %d. %s (ville %d)", i + 1,
+                   graph->cityNames[cityIndex], cityIndex);
+        } else {
+            printf("  %d. Ville %d", i + 1, cityIndex);
+        }
+        if (i < result->tourLength - 1) {
+            printf(" ---> ");
+        }
+        printf("\n");
+    }
+    printf("\n");
+}
 /**
  * Affiche le résultat du TSP
  */
@@ -138,20 +157,55 @@ void displayTSPResult(TSPResult* result, Graph* graph) {
         printf("(Certaines villes ne sont pas connectees)\n");
         return;
     }
-    printf("Distance totale minimale : %d\n\n", result->totalDistance);
+    printf("Distance totale minimale : %" WEIGHT_FMT "\n\n",
+           WEIGHT_PRINT(result->totalDistance));
     printf("Tour optimal :\n");
-    for (int i = 0; i < result->tourLength; i++) {
-        int cityIndex = result->tour[i];
-        if (graph != NULL) {
-            printf("  %d. %s (ville %d)", i + 1,
-                   graph->cityNames[cityIndex], cityIndex);
-        } else {
-            printf("  %d. Ville %d", i + 1, cityIndex);
-        }
-        if (i < result->tourLength - 1) {
-            printf(" ---> ");
+    printTourCities(result, graph);
+}
+/**
+ * Affiche un tour dont l'optimalité n'est pas garantie
+ * (par exemple un tour réparé localement)
+ */
+void displayTour(TSPResult* result, Graph* graph) {
+    if (result == NULL) {
+        printf("Resultat NULL\n");
+        return;
+    }
+    printf("\n===== TOUR =====\n\n");
+    if (result->totalDistance == INF) {
+        printf("Aucun tour valide trouve!\n");
+        printf("(Certaines villes ne sont pas connectees)\n");
+        return;
+    }
+    printf("Distance totale : %" WEIGHT_FMT "\n\n",
+           WEIGHT_PRINT(result->totalDistance));
+    printf("Tour (non forcement optimal) :\n");
+    printTourCities(result, graph);
+}
+/**
+ * Développe le tour en itinéraire routier
+ */
+int expandTourToRoadPath(TSPResult* result,
+                         HopIndex nextHop[MAX_CITIES][MAX_CITIES],
+                         int* roadPath, int maxLength) {
+    if (result == NULL || nextHop == NULL || roadPath == NULL ||
+        result->tourLength <= 0 || maxLength <= 0) {
+        return -1;
+    }
+    int length = 0;
+    roadPath[length++] = result->tour[0];
+    for (int i = 0; i < result->tourLength - 1; i++) {
+        int current = result->tour[i];
+        int target = result->tour[i + 1];
+        // Suivre les sauts jusqu'à la prochaine étape du tour
+        while (current != target) {
+            HopIndex hop = nextHop[current][target];
+            if (hop == NO_HOP || length >= maxLength) {
+                return -1;
+            }
+            current = hop;
+            roadPath[length++] = current;
         }
-        printf("\n");
     }
-    printf("\n");
+    return length;
 }
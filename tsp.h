@@ -4,6 +4,10 @@
 #ifndef TSP_H
 #define TSP_H
 #include "graph.h"
+// Longueur maximale d'un itinéraire routier (chaque étape <= MAX_CITIES - 1 routes)
+#define MAX_ROAD_PATH (MAX_CITIES * (MAX_CITIES - 1) + 1)
+// Au-delà, (n-1)! permutations : utiliser solveTSPBatch (Held-Karp)
+#define BRUTE_FORCE_MAX_CITIES 10
 // ══════════════════════════════════════════════════════════════════
 // STRUCTURES DE DONNÉES
 // ══════════════════════════════════════════════════════════════════
@@ -16,7 +20,7 @@
 typedef struct {
     int tour[MAX_CITIES + 1];   // +1 pour le retour à la ville de départ
     int tourLength;             // Nombre d'étapes dans le tour
-    int totalDistance;          // Distance totale du tour optimal
+    Weight totalDistance;       // Distance totale du tour optimal
 } TSPResult;
 
 // ══════════════════════════════════════════════════════════════════
@@ -30,9 +34,9 @@ typedef struct {
  * @param numCities : nombre de villes
  * @param startCity : ville de départ (index)
  * @return : structure contenant le tour optimal et sa distance
- * Complexité : O(n!) - très lent pour n > 10
+ * Complexité : O(n!) - refusé pour n > BRUTE_FORCE_MAX_CITIES
  */
-TSPResult solveTSPBruteForce(int distMatrix[MAX_CITIES][MAX_CITIES],
+TSPResult solveTSPBruteForce(Weight distMatrix[MAX_CITIES][MAX_CITIES],
                               int numCities,
                               int startCity);
 /**
@@ -41,6 +45,13 @@ TSPResult solveTSPBruteForce(int distMatrix[MAX_CITIES][MAX_CITIES],
  * @param graph : graphe (pour afficher les noms des villes)
  */
 void displayTSPResult(TSPResult* result, Graph* graph);
+/**
+ * Affiche un tour sans le présenter comme optimal
+ * (tour réparé ou amélioré localement)
+ * @param result : le tour
+ * @param graph : graphe (pour afficher les noms des villes)
+ */
+void displayTour(TSPResult* result, Graph* graph);
 /**
  * Fonction utilitaire pour échanger deux éléments
  * @param a : pointeur vers le premier élément
@@ -54,6 +65,20 @@ void swap(int* a, int* b);
  * @param distMatrix : matrice des distances
  * @return : distance totale du tour
  */
-int calculateTourDistance(int* tour, int tourLength,
-                          int distMatrix[MAX_CITIES][MAX_CITIES]);
+Weight calculateTourDistance(int* tour, int tourLength,
+                             Weight distMatrix[MAX_CITIES][MAX_CITIES]);
+/**
+ * Développe le tour en itinéraire routier complet (ville par ville)
+ * en suivant la table des prochains sauts, sans relancer Dijkstra
+ * @param result : résultat du TSP (étapes dans la fermeture métrique)
+ * @param nextHop : table calculée par computeAllPairsShortestPathsWithHops
+ * @param roadPath : tableau pour stocker l'itinéraire
+ * @param maxLength : taille de roadPath (MAX_ROAD_PATH suffit toujours)
+ * @return : nombre de villes de l'itinéraire, -1 si une étape est
+ *           impossible ou si roadPath est trop petit
+ * Complexité : O(longueur de l'itinéraire)
+ */
+int expandTourToRoadPath(TSPResult* result,
+                         HopIndex nextHop[MAX_CITIES][MAX_CITIES],
+                         int* roadPath, int maxLength);
 #endif // TSP_H
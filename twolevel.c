@@ -0,0 +1,419 @@
+/**
+ * Implémentation du tour en liste doublement chaînée à deux niveaux
+ */
+#include "twolevel.h"
+#include <limits.h>
+#include <math.h>
+// ══════════════════════════════════════════════════════════════════
+// FONCTIONS AUXILIAIRES
+// ══════════════════════════════════════════════════════════════════
+/**
+ * Première et dernière ville d'un segment dans le sens de l'anneau
+ */
+static int headOf(TwoLevelTour* t, int s) {
+    return t->reversed[s] ? t->last[s] : t->first[s];
+}
+
+static int tailOf(TwoLevelTour* t, int s) {
+    return t->reversed[s] ? t->first[s] : t->last[s];
+}
+
+static int sizeOf(TwoLevelTour* t, int s) {
+    return t->id[t->last[s]] - t->id[t->first[s]] + 1;
+}
+
+/**
+ * Voisins dans le sens de l'anneau (sans tenir compte de flipped)
+ */
+static int successor(TwoLevelTour* t, int city) {
+    int s = t->segment[city];
+    if (city == tailOf(t, s)) {
+        return headOf(t, t->nextSegment[s]);
+    }
+    return t->reversed[s] ? t->prevCity[city] : t->nextCity[city];
+}
+
+static int predecessor(TwoLevelTour* t, int city) {
+    int s = t->segment[city];
+    if (city == headOf(t, s)) {
+        return tailOf(t, t->prevSegment[s]);
+    }
+    return t->reversed[s] ? t->nextCity[city] : t->prevCity[city];
+}
+
+/**
+ * Découpe l'ordre de visite en segments d'environ √n villes
+ */
+static void layout(TwoLevelTour* t, const int* order) {
+    int n = t->count;
+    int groupSize = t->groupSize;
+    int numSegments = t->numSegments;
+
+    for (int s = 0; s < numSegments; s++) {
+        int start = s * groupSize;
+        int end = (start + groupSize < n) ? start + groupSize : n;
+        for (int k = start; k < end; k++) {
+            int city = order[k];
+            t->segment[city] = s;
+            t->id[city] = k - start;
+            t->prevCity[city] = (k > start) ? order[k - 1] : -1;
+            t->nextCity[city] = (k < end - 1) ? order[k + 1] : -1;
+        }
+        t->first[s] = order[start];
+        t->last[s] = order[end - 1];
+        t->reversed[s] = 0;
+        t->rank[s] = s;
+        t->nextSegment[s] = (s + 1) % numSegments;
+        t->prevSegment[s] = (s + numSegments - 1) % numSegments;
+    }
+    t->headSegment = 0;
+}
+
+/**
+ * Redécoupage complet en O(n), quand un segment a trop grossi
+ */
+static void rebuild(TwoLevelTour* t) {
+    int city = headOf(t, t->headSegment);
+    for (int i = 0; i < t->count; i++) {
+        t->buffer[i] = city;
+        city = successor(t, city);
+    }
+    layout(t, t->buffer);
+}
+
+/**
+ * Renumérote les villes d'un segment à partir de 0, avant que les ids
+ * ne dérivent hors des entiers à force d'ajouts en tête
+ */
+static void renumberSegment(TwoLevelTour* t, int s) {
+    if (t->id[t->first[s]] > INT_MIN / 2 && t->id[t->last[s]] < INT_MAX / 2) return;
+    int id = 0;
+    for (int city = t->first[s]; city != -1; city = t->nextCity[city]) {
+        t->id[city] = id++;
+    }
+}
+
+/**
+ * Ajoute city à la fin (pushTail) ou au début (pushHead) du segment s,
+ * dans le sens de l'anneau : l'id continue celui de la ville voisine
+ */
+static void pushTail(TwoLevelTour* t, int s, int city) {
+    t->segment[city] = s;
+    if (!t->reversed[s]) {
+        int end = t->last[s];
+        t->id[city] = t->id[end] + 1;
+        t->nextCity[end] = city;
+        t->prevCity[city] = end;
+        t->nextCity[city] = -1;
+        t->last[s] = city;
+    } else {
+        int end = t->first[s];
+        t->id[city] = t->id[end] - 1;
+        t->prevCity[end] = city;
+        t->nextCity[city] = end;
+        t->prevCity[city] = -1;
+        t->first[s] = city;
+    }
+}
+
+static void pushHead(TwoLevelTour* t, int s, int city) {
+    t->reversed[s] ^= 1;
+    pushTail(t, s, city);
+    t->reversed[s] ^= 1;
+}
+
+/**
+ * Fait de x la première ville de son segment (sens de l'anneau)
+ *
+ * Le nombre de segments reste fixe : la plus petite des deux parties
+ * (avant x, ou x et la suite) rejoint le segment voisin de son côté.
+ * Coût : O(taille de la partie déplacée).
+ * keep est une ville qui doit rester en tête de son segment (-1 : aucune).
+ * @return : le segment qui a reçu des villes (-1 : aucun)
+ */
+static int splitBefore(TwoLevelTour* t, int x, int keep) {
+    int s = t->segment[x];
+    if (x == headOf(t, s)) return -1;
+
+    int p = t->prevSegment[s];
+    int q = t->nextSegment[s];
+    int beforeSize = t->reversed[s] ? t->id[t->last[s]] - t->id[x]
+                                    : t->id[x] - t->id[t->first[s]];
+    int afterSize = sizeOf(t, s) - beforeSize;
+    // Ajouter en fin de p garde sa tête ; ajouter en tête de q la remplace
+    int canMoveBefore = (p != s && headOf(t, s) != keep);
+    int canMoveAfter = (q != s && headOf(t, q) != keep);
+    int moveBefore = canMoveBefore && (!canMoveAfter || beforeSize <= afterSize);
+    int receiver = moveBefore ? p : q;
+
+    if (moveBefore) {
+        int city = headOf(t, s);
+        for (int i = 0; i < beforeSize; i++) {
+            int next = t->reversed[s] ? t->prevCity[city] : t->nextCity[city];
+            pushTail(t, p, city);
+            city = next;
+        }
+        if (t->reversed[s]) {
+            t->last[s] = x;
+            t->nextCity[x] = -1;
+        } else {
+            t->first[s] = x;
+            t->prevCity[x] = -1;
+        }
+    } else {
+        int newTail = t->reversed[s] ? t->nextCity[x] : t->prevCity[x];
+        int city = tailOf(t, s);
+        for (int i = 0; i < afterSize; i++) {
+            int prev = t->reversed[s] ? t->nextCity[city] : t->prevCity[city];
+            pushHead(t, q, city);
+            city = prev;
+        }
+        if (t->reversed[s]) {
+            t->first[s] = newTail;
+            t->prevCity[newTail] = -1;
+        } else {
+            t->last[s] = newTail;
+            t->nextCity[newTail] = -1;
+        }
+    }
+    renumberSegment(t, receiver);
+    return receiver;
+}
+
+/**
+ * Inverse la suite de k segments firstSeg -> lastSeg (k < numSegments)
+ * Seuls les rangs de ces k segments changent : coût O(k).
+ */
+static void reverseSegments(TwoLevelTour* t, int firstSeg, int lastSeg, int k) {
+    int n = t->numSegments;
+    int r = t->rank[firstSeg];
+    int p = t->prevSegment[firstSeg];
+    int q = t->nextSegment[lastSeg];
+    int i = 0;
+    for (int s = firstSeg; ; s = t->nextSegment[s]) {
+        t->buffer[i++] = s;
+        if (s == lastSeg) break;
+    }
+
+    // Inverser chaque segment puis rebrancher la suite entre p et q
+    for (i = 0; i < k; i++) {
+        int s = t->buffer[i];
+        int next = t->nextSegment[s];
+        t->reversed[s] ^= 1;
+        t->nextSegment[s] = t->prevSegment[s];
+        t->prevSegment[s] = next;
+    }
+    t->nextSegment[p] = lastSeg;
+    t->prevSegment[lastSeg] = p;
+    t->nextSegment[firstSeg] = q;
+    t->prevSegment[q] = firstSeg;
+
+    // Les segments reprennent les mêmes rangs, dans l'ordre inverse
+    for (i = 0; i < k; i++) {
+        int s = t->buffer[k - 1 - i];
+        t->rank[s] = (r + i) % n;
+        if (t->rank[s] == 0) t->headSegment = s;
+    }
+}
+
+/**
+ * Compare la position de deux villes depuis headSegment
+ * @return : négatif si x est avant y, 0 si égales, positif sinon
+ */
+static int compareOrder(TwoLevelTour* t, int x, int y) {
+    int sx = t->segment[x];
+    int sy = t->segment[y];
+    if (sx != sy) return t->rank[sx] - t->rank[sy];
+    return t->reversed[sx] ? t->id[y] - t->id[x] : t->id[x] - t->id[y];
+}
+// ══════════════════════════════════════════════════════════════════
+// CRÉATION ET CONVERSIONS
+// ══════════════════════════════════════════════════════════════════
+TwoLevelTour* createTwoLevelTour(const int* order, int count, int capacity) {
+    if (order == NULL || count <= 0 || capacity < count) {
+        printf("Erreur: tour invalide\n");
+        return NULL;
+    }
+    TwoLevelTour* t = (TwoLevelTour*)calloc(1, sizeof(TwoLevelTour));
+    if (t == NULL) {
+        printf("Erreur: allocation memoire echouee\n");
+        return NULL;
+    }
+    t->capacity = capacity;
+    t->count = count;
+    t->groupSize = (int)ceil(sqrt((double)count));
+    t->numSegments = (count + t->groupSize - 1) / t->groupSize;
+    t->maxSegmentSize = 8 * t->groupSize;
+    t->flipped = 0;
+    t->segment = (int*)malloc(sizeof(int) * capacity);
+    t->id = (int*)malloc(sizeof(int) * capacity);
+    t->nextCity = (int*)malloc(sizeof(int) * capacity);
+    t->prevCity = (int*)malloc(sizeof(int) * capacity);
+    t->reversed = (unsigned char*)malloc(t->numSegments);
+    t->first = (int*)malloc(sizeof(int) * t->numSegments);
+    t->last = (int*)malloc(sizeof(int) * t->numSegments);
+    t->rank = (int*)malloc(sizeof(int) * t->numSegments);
+    t->nextSegment = (int*)malloc(sizeof(int) * t->numSegments);
+    t->prevSegment = (int*)malloc(sizeof(int) * t->numSegments);
+    t->buffer = (int*)malloc(sizeof(int) * count);
+    if (t->segment == NULL || t->id == NULL || t->nextCity == NULL ||
+        t->prevCity == NULL || t->reversed == NULL || t->first == NULL ||
+        t->last == NULL || t->rank == NULL || t->nextSegment == NULL ||
+        t->prevSegment == NULL || t->buffer == NULL) {
+        printf("Erreur: allocation memoire echouee\n");
+        freeTwoLevelTour(t);
+        return NULL;
+    }
+
+    // Vérifier que chaque ville apparaît au plus une fois
+    for (int i = 0; i < capacity; i++) {
+        t->segment[i] = -1;
+    }
+    for (int i = 0; i < count; i++) {
+        if (order[i] < 0 || order[i] >= capacity || t->segment[order[i]] != -1) {
+            printf("Erreur: ville invalide ou repetee dans le tour (%d)\n", order[i]);
+            freeTwoLevelTour(t);
+            return NULL;
+        }
+        t->segment[order[i]] = 0;
+    }
+
+    layout(t, order);
+    return t;
+}
+
+TwoLevelTour* twoLevelTourFromResult(TSPResult* result) {
+    if (result == NULL || result->tourLength < 2) {
+        printf("Erreur: resultat du TSP vide\n");
+        return NULL;
+    }
+    // Le dernier élément est le retour à la ville de départ
+    return createTwoLevelTour(result->tour, result->tourLength - 1, MAX_CITIES);
+}
+
+int twoLevelTourToArray(TwoLevelTour* tour, int startCity, int* order) {
+    if (tour == NULL || order == NULL || startCity < 0 ||
+        startCity >= tour->capacity || tour->segment[startCity] == -1) {
+        return 0;
+    }
+    int city = startCity;
+    for (int i = 0; i < tour->count; i++) {
+        order[i] = city;
+        city = twoLevelNext(tour, city);
+    }
+    return tour->count;
+}
+
+int twoLevelTourToResult(TwoLevelTour* tour, int startCity,
+                         Weight distMatrix[MAX_CITIES][MAX_CITIES],
+                         TSPResult* result) {
+    if (tour == NULL || result == NULL || tour->count > MAX_CITIES) {
+        return 0;
+    }
+    int count = twoLevelTourToArray(tour, startCity, result->tour);
+    if (count == 0) return 0;
+    // distMatrix n'indexe que les villes 0 à MAX_CITIES - 1
+    for (int i = 0; i < count; i++) {
+        if (result->tour[i] >= MAX_CITIES) {
+            result->tourLength = 0;
+            return 0;
+        }
+    }
+    result->tour[count] = startCity;
+    result->tourLength = count + 1;
+    result->totalDistance = calculateTourDistance(result->tour, count, distMatrix);
+    return 1;
+}
+// ══════════════════════════════════════════════════════════════════
+// REQUÊTES ET INVERSION
+// ══════════════════════════════════════════════════════════════════
+int twoLevelNext(TwoLevelTour* tour, int city) {
+    return tour->flipped ? predecessor(tour, city) : successor(tour, city);
+}
+
+int twoLevelPrev(TwoLevelTour* tour, int city) {
+    return tour->flipped ? successor(tour, city) : predecessor(tour, city);
+}
+
+int twoLevelBetween(TwoLevelTour* tour, int a, int b, int c) {
+    if (tour->flipped) {
+        int swapped = a;    // a -> c dans le tour = c -> a dans l'anneau
+        a = c;
+        c = swapped;
+    }
+    int ab = compareOrder(tour, a, b) <= 0;
+    int bc = compareOrder(tour, b, c) <= 0;
+    if (compareOrder(tour, a, c) <= 0) {
+        return ab && bc;
+    }
+    return ab || bc;    // Le trajet a -> c repasse par headSegment
+}
+
+/**
+ * Inversion du trajet from -> to
+ *
+ * PRINCIPE :
+ * 1. Couper pour que from commence un segment et que la ville qui suit
+ *    to en commence un autre
+ * 2. Le trajet et son complément sont alors deux suites de segments
+ *    entiers : inverser la plus courte (ordre dans l'anneau et bits
+ *    d'inversion). Inverser le complément donne le même cycle lu dans
+ *    l'autre sens : il suffit de basculer flipped.
+ * 3. Redécouper tout le tour si un segment a trop grossi
+ */
+void twoLevelReverse(TwoLevelTour* tour, int from, int to) {
+    if (tour == NULL || from == to) return;
+
+    if (tour->flipped) {
+        int swapped = from;     // Même trajet, lu dans le sens de l'anneau
+        from = to;
+        to = swapped;
+    }
+    int after = successor(tour, to);
+    if (after == from) {
+        tour->flipped ^= 1;     // Tout le tour : seul le sens change
+        return;
+    }
+
+    // ÉTAPE 1 : Coupures (la seconde ne doit pas déplacer from)
+    int grown[2];
+    grown[0] = splitBefore(tour, from, -1);
+    grown[1] = splitBefore(tour, after, from);
+
+    // ÉTAPE 2 : Inverser la plus courte des deux suites de segments
+    int n = tour->numSegments;
+    int firstSeg = tour->segment[from];
+    int lastSeg = tour->segment[to];
+    int k = (tour->rank[lastSeg] - tour->rank[firstSeg] + n) % n + 1;
+    if (2 * k <= n) {
+        reverseSegments(tour, firstSeg, lastSeg, k);
+    } else {
+        reverseSegments(tour, tour->segment[after], tour->prevSegment[firstSeg], n - k);
+        tour->flipped ^= 1;
+    }
+
+    // ÉTAPE 3 : Seuls les segments qui ont reçu des villes ont grossi
+    for (int i = 0; i < 2; i++) {
+        if (grown[i] != -1 && sizeOf(tour, grown[i]) > tour->maxSegmentSize) {
+            rebuild(tour);
+            return;
+        }
+    }
+}
+
+void freeTwoLevelTour(TwoLevelTour* tour) {
+    if (tour != NULL) {
+        free(tour->segment);
+        free(tour->id);
+        free(tour->nextCity);
+        free(tour->prevCity);
+        free(tour->reversed);
+        free(tour->first);
+        free(tour->last);
+        free(tour->rank);
+        free(tour->nextSegment);
+        free(tour->prevSegment);
+        free(tour->buffer);
+        free(tour);
+    }
+}
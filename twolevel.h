@@ -0,0 +1,113 @@
+/**
+ *      Tour sous forme de liste doublement chaînée à deux niveaux
+ */
+#ifndef TWOLEVEL_H
+#define TWOLEVEL_H
+#include "tsp.h"
+// ══════════════════════════════════════════════════════════════════
+// STRUCTURES DE DONNÉES
+// ══════════════════════════════════════════════════════════════════
+/**
+ * Le tour est découpé en environ √n segments consécutifs.
+ * Chaque segment a un bit d'inversion : inverser une suite de segments
+ * revient à inverser leur ordre et leurs bits, en O(√n) au lieu de O(n).
+ *
+ * Dans un segment, les villes sont chaînées par id croissant (sens
+ * interne) ; le sens de parcours de l'anneau est le sens interne, ou
+ * l'inverse si reversed[segment] vaut 1. Le tour se lit dans le sens
+ * de l'anneau, ou dans l'autre sens si flipped vaut 1.
+ *
+ * Le nombre de segments est fixé à la création : une coupure déplace
+ * la plus petite partie du segment dans son voisin.
+ */
+typedef struct {
+    int capacity;               // Villes indexées de 0 à capacity - 1
+    int count;                  // Nombre de villes dans le tour
+    // Niveau des villes
+    int* segment;               // Segment de chaque ville (-1 : hors du tour)
+    int* id;                    // Numéro d'ordre interne (contigu par segment)
+    int* nextCity;              // Voisin interne d'id supérieur (-1 : aucun)
+    int* prevCity;              // Voisin interne d'id inférieur (-1 : aucun)
+    // Niveau des segments (anneau doublement chaîné)
+    int groupSize;              // Taille initiale des segments (≈ √n)
+    int maxSegmentSize;         // Au-delà : redécoupage complet
+    int numSegments;
+    int headSegment;            // Segment de rang 0
+    int flipped;                // 1 : tour lu à rebours de l'anneau
+    unsigned char* reversed;    // Bit d'inversion
+    int* first;                 // Ville d'id minimal
+    int* last;                  // Ville d'id maximal
+    int* rank;                  // Position dans l'anneau depuis headSegment
+    int* nextSegment;
+    int* prevSegment;
+    int* buffer;                // Tampon (redécoupage, inversion)
+} TwoLevelTour;
+
+// ══════════════════════════════════════════════════════════════════
+// PROTOTYPES DES FONCTIONS
+// ══════════════════════════════════════════════════════════════════
+
+/**
+ * Crée un tour à deux niveaux à partir d'un ordre de visite
+ * @param order : villes dans l'ordre du tour (sans retour au départ)
+ * @param count : nombre de villes dans order
+ * @param capacity : plus grand index de ville + 1
+ * @return : pointeur vers le tour créé (NULL en cas d'erreur)
+ */
+TwoLevelTour* createTwoLevelTour(const int* order, int count, int capacity);
+/**
+ * Crée un tour à deux niveaux à partir d'un résultat du TSP
+ * @param result : résultat du TSP
+ * @return : pointeur vers le tour créé (NULL en cas d'erreur)
+ */
+TwoLevelTour* twoLevelTourFromResult(TSPResult* result);
+/**
+ * Recopie le tour dans un tableau, en partant de startCity
+ * @param tour : le tour
+ * @param startCity : première ville (doit appartenir au tour)
+ * @param order : tableau d'au moins tour->count cases
+ * @return : nombre de villes écrites (0 si startCity est absente)
+ */
+int twoLevelTourToArray(TwoLevelTour* tour, int startCity, int* order);
+/**
+ * Convertit le tour en résultat du TSP (retour au départ inclus)
+ * @param tour : le tour (au plus MAX_CITIES villes, toutes d'index
+ *               inférieur à MAX_CITIES même si capacity est plus grand)
+ * @param startCity : ville de départ
+ * @param distMatrix : matrice des distances, pour totalDistance
+ * @param result : résultat à remplir
+ * @return : 1 en cas de succès, 0 sinon (tour trop long, startCity
+ *           absente, ou ville hors de distMatrix)
+ */
+int twoLevelTourToResult(TwoLevelTour* tour, int startCity,
+                         Weight distMatrix[MAX_CITIES][MAX_CITIES],
+                         TSPResult* result);
+/**
+ * Ville suivante dans le sens du tour - O(1)
+ */
+int twoLevelNext(TwoLevelTour* tour, int city);
+/**
+ * Ville précédente dans le sens du tour - O(1)
+ */
+int twoLevelPrev(TwoLevelTour* tour, int city);
+/**
+ * Indique si b se trouve sur le trajet a -> c (sens du tour, bornes
+ * incluses) - O(1)
+ * @return : 1 si oui, 0 sinon
+ */
+int twoLevelBetween(TwoLevelTour* tour, int a, int b, int c);
+/**
+ * Inverse le trajet from -> to (sens du tour, bornes incluses)
+ * Mouvement 2-opt : avec a = prev(from) et d = next(to), les arêtes
+ * (a,from) et (to,d) deviennent (a,to) et (from,d).
+ * Complexité : O(√n) en pratique (parties de segments déplacées, plus
+ * courte des deux suites de segments inversée) ; redécoupage complet
+ * en O(n) seulement si un segment dépasse maxSegmentSize
+ */
+void twoLevelReverse(TwoLevelTour* tour, int from, int to);
+/**
+ * Libère la mémoire du tour
+ * @param tour : le tour à libérer
+ */
+void freeTwoLevelTour(TwoLevelTour* tour);
+#endif // TWOLEVEL_H
@@ -0,0 +1,85 @@
+/**
+ *      Type des distances, choisi à la compilation
+ *
+ * Options (une seule à la fois, par exemple -DWEIGHT_UINT16) :
+ *   WEIGHT_UINT16 : entiers 16 bits non signés (petites instances)
+ *   WEIGHT_INT64  : entiers 64 bits
+ *   WEIGHT_FLOAT  : flottants simple précision
+ *   WEIGHT_FIXED  : virgule fixe 32 bits (WEIGHT_FIXED_SHIFT bits de fraction)
+ *   (aucune)      : entiers 32 bits signés
+ *
+ * INF est la plus grande valeur du type (infini pour les flottants) et
+ * addWeights sature à INF : les boucles n'ont pas à tester INF.
+ * WEIGHT_MAX_INT est le plus grand entier que WEIGHT_FROM_INT convertit
+ * exactement sans atteindre INF : les saisies sont à vérifier contre
+ * [0, WEIGHT_MAX_INT] avant conversion.
+ */
+#ifndef WEIGHT_H
+#define WEIGHT_H
+#include <limits.h>
+#include <math.h>
+// ══════════════════════════════════════════════════════════════════
+// TYPE DES DISTANCES
+// ══════════════════════════════════════════════════════════════════
+#if defined(WEIGHT_UINT16)
+typedef unsigned short Weight;
+#define INF USHRT_MAX
+#define WEIGHT_FMT "u"
+#define WEIGHT_WIDTH 6    // Largeur d'une colonne de tableau
+#define WEIGHT_MAX_INT (USHRT_MAX - 1)
+#define WEIGHT_PRINT(w) ((unsigned)(w))
+#define WEIGHT_FROM_INT(x) ((Weight)(x))
+#define WEIGHT_FROM_DOUBLE(x) ((Weight)floor(x))
+#elif defined(WEIGHT_INT64)
+typedef long long Weight;
+#define INF LLONG_MAX
+#define WEIGHT_FMT "lld"
+#define WEIGHT_WIDTH 6
+#define WEIGHT_MAX_INT INT_MAX
+#define WEIGHT_PRINT(w) ((long long)(w))
+#define WEIGHT_FROM_INT(x) ((Weight)(x))
+#define WEIGHT_FROM_DOUBLE(x) ((Weight)floor(x))
+#elif defined(WEIGHT_FLOAT)
+typedef float Weight;
+#define INF INFINITY
+#define WEIGHT_FMT ".1f"
+#define WEIGHT_WIDTH 8
+#define WEIGHT_MAX_INT (1 << 24) // Entiers exacts en simple précision
+#define WEIGHT_PRINT(w) ((double)(w))
+#define WEIGHT_FROM_INT(x) ((Weight)(x))
+#define WEIGHT_FROM_DOUBLE(x) ((Weight)(x))
+#elif defined(WEIGHT_FIXED)
+#define WEIGHT_FIXED_SHIFT 4    // Précision : 1/16 d'unité
+typedef int Weight;
+#define INF INT_MAX
+#define WEIGHT_FMT ".2f"
+#define WEIGHT_WIDTH 9
+#define WEIGHT_MAX_INT (INT_MAX >> WEIGHT_FIXED_SHIFT)
+#define WEIGHT_PRINT(w) ((double)(w) / (1 << WEIGHT_FIXED_SHIFT))
+#define WEIGHT_FROM_INT(x) ((Weight)(x) << WEIGHT_FIXED_SHIFT)
+#define WEIGHT_FROM_DOUBLE(x) ((Weight)floor((x) * (1 << WEIGHT_FIXED_SHIFT)))
+#else
+typedef int Weight;
+#define INF INT_MAX         // Valeur "infini" (pas de connexion)
+#define WEIGHT_FMT "d"
+#define WEIGHT_WIDTH 6
+#define WEIGHT_MAX_INT (INT_MAX - 1)
+#define WEIGHT_PRINT(w) (w)
+#define WEIGHT_FROM_INT(x) ((Weight)(x))
+#define WEIGHT_FROM_DOUBLE(x) ((Weight)floor(x))
+#endif
+// ══════════════════════════════════════════════════════════════════
+// ARITHMÉTIQUE SATURANTE
+// ══════════════════════════════════════════════════════════════════
+/**
+ * Somme de deux distances positives, bornée à INF
+ * (compilée en sélection conditionnelle, sans saut)
+ */
+static inline Weight addWeights(Weight a, Weight b) {
+#if defined(WEIGHT_FLOAT)
+    return a + b;               // INF + x = INF en IEEE 754
+#else
+    return (a > INF - b) ? INF : (Weight)(a + b);
+#endif
+}
+#endif // WEIGHT_H